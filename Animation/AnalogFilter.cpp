@@ -0,0 +1,47 @@
+/**
+ * @file AnalogFilter.cpp
+ * @brief Implementation of the analog "hold" input filter.
+ */
+
+#include "AnalogFilter.hpp"
+#include <algorithm> // For std::clamp
+#include <cmath>     // For std::exp, std::fabs
+
+namespace SPF_FrontalBlindspotViewer
+{
+
+    bool UpdateAnalogFilter(AnalogFilter &filter, float input, float dt, const AnalogFilterSettings &settings)
+    {
+        float target = std::clamp(input, 0.0f, 1.0f);
+
+        // Exponential low-pass; the exp keeps the response the same at any frame rate.
+        float next = target;
+        if (settings.smoothing_time > 0.0f)
+        {
+            float alpha = 1.0f - std::exp(-dt / settings.smoothing_time);
+            next = filter.smoothed + (target - filter.smoothed) * alpha;
+
+            // The exponential never quite arrives; settle once the rest is below the deadband.
+            if (std::fabs(target - next) < settings.deadband * 0.5f)
+                next = target;
+        }
+
+        // Slew limit, so a digital key moves the camera at the animation speed.
+        if (settings.max_rate > 0.0f)
+        {
+            float max_step = settings.max_rate * dt;
+            next = std::clamp(next, filter.smoothed - max_step, filter.smoothed + max_step);
+        }
+        filter.smoothed = next;
+
+        // Deadband: ignore small wobbles, but always let the ends of the range through.
+        bool at_end = (next == 0.0f || next == 1.0f) && next != filter.output;
+        if (at_end || std::fabs(next - filter.output) > settings.deadband)
+        {
+            filter.output = next;
+            return true;
+        }
+        return false;
+    }
+
+} // namespace SPF_FrontalBlindspotViewer
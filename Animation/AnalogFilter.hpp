@@ -0,0 +1,38 @@
+/**
+ * @file AnalogFilter.hpp
+ * @brief Conditioning of the analog "hold" input before it is mapped onto the peek curve.
+ *
+ * @details The raw action value is low-passed (frame-rate independent), slew-limited so a
+ * digital key press becomes a smooth press/release movement, and held behind a deadband so that
+ * jitter from the input pipeline does not produce a new camera pose every frame. The ends of the
+ * range are never swallowed by the deadband, so a fully pressed or released input always ends
+ * exactly on 1 or 0.
+ */
+#pragma once
+
+namespace SPF_FrontalBlindspotViewer {
+
+/**
+ * @brief User-tunable behaviour of the filter.
+ */
+struct AnalogFilterSettings {
+  float smoothing_time = 0.05f; // Low-pass time constant in seconds; 0 disables smoothing.
+  float max_rate = 1.0f;        // Largest change of the output per second; 0 disables the limit.
+  float deadband = 0.01f;       // Smallest change of the output that is passed on.
+};
+
+/**
+ * @brief The state of one filtered input.
+ */
+struct AnalogFilter {
+  float smoothed = 0.0f; // Low-passed and slew-limited input.
+  float output = 0.0f;   // The value last passed on (0..1).
+};
+
+/**
+ * @brief Feeds one raw input sample (clamped to 0..1) taken `dt` seconds after the previous one.
+ * @return `true` if `filter.output` changed.
+ */
+bool UpdateAnalogFilter(AnalogFilter& filter, float input, float dt, const AnalogFilterSettings& settings);
+
+}  // namespace SPF_FrontalBlindspotViewer
@@ -0,0 +1,66 @@
+/**
+ * @file AnimationClock.cpp
+ * @brief Implementation of the timestamp-driven animation clock.
+ */
+
+#include "AnimationClock.hpp"
+#include <algorithm> // For std::min, std::max
+
+namespace SPF_FrontalBlindspotViewer
+{
+
+    namespace
+    {
+        // The progress the animation would have reached at `now` without any step limit.
+        double TrueProgress(const AnimationClock &clock, double now)
+        {
+            return clock.base_progress + (now - clock.base_time) * clock.speed;
+        }
+    } // namespace
+
+    void StartAnimationClock(AnimationClock &clock, double now, double speed, double progress)
+    {
+        clock.base_time = now;
+        clock.base_progress = progress;
+        clock.speed = speed;
+        clock.last_time = now;
+        clock.shown_progress = progress;
+    }
+
+    void SetAnimationClockSpeed(AnimationClock &clock, double now, double speed)
+    {
+        // Rebase at the unlimited progress, so a catch-up that is still in flight is preserved.
+        clock.base_progress = TrueProgress(clock, now);
+        clock.base_time = now;
+        clock.speed = speed;
+    }
+
+    void ResumeAnimationClock(AnimationClock &clock, double now)
+    {
+        StartAnimationClock(clock, now, clock.speed, clock.shown_progress);
+    }
+
+    AnimationClockTick TickAnimationClock(AnimationClock &clock, double now, const AnimationClockSettings &settings)
+    {
+        AnimationClockTick tick;
+        tick.frame_time = std::max(0.0, now - clock.last_time);
+        tick.hitch = tick.frame_time > settings.hitch_threshold;
+        if (tick.hitch)
+        {
+            ++clock.hitch_count;
+        }
+
+        tick.progress = TrueProgress(clock, now);
+        if (settings.max_step > 0.0)
+        {
+            // Show at most `max_step` seconds of animation this frame. After a hitch the shown
+            // progress trails the true one and closes the gap by that much every frame.
+            tick.progress = std::min(tick.progress, clock.shown_progress + settings.max_step * clock.speed);
+        }
+
+        clock.last_time = now;
+        clock.shown_progress = tick.progress;
+        return tick;
+    }
+
+} // namespace SPF_FrontalBlindspotViewer
@@ -0,0 +1,73 @@
+/**
+ * @file AnimationClock.hpp
+ * @brief Timestamp-driven animation progress with hitch-aware catch-up.
+ *
+ * @details Progress is never accumulated from frame deltas. It is computed from the time the
+ * animation was started (or last rebased) as `base_progress + (now - base_time) * speed` in
+ * double precision, so the camera is at the same point of the path at the same wall-clock time
+ * whatever the frame rate is, and there is no rounding drift from summing small deltas.
+ *
+ * A frame hitch (e.g. the game streaming map sectors) would make that progress jump most of the
+ * way in one frame. When `AnimationClockSettings::max_step` is set, the progress shown per frame
+ * is limited to that much animation time and the clock catches up over the following frames
+ * instead. Frames longer than `hitch_threshold` are counted and reported either way.
+ */
+#pragma once
+
+#include <cstdint> // For uint64_t
+
+namespace SPF_FrontalBlindspotViewer {
+
+/**
+ * @brief User-tunable behaviour of the clock.
+ */
+struct AnimationClockSettings {
+  double max_step = 0.05;       // Largest animation time (s) shown in one frame; 0 disables the limit.
+  double hitch_threshold = 0.1; // Frames longer than this (s) are reported as hitches.
+};
+
+/**
+ * @brief The state of one running animation's clock. All times are in seconds.
+ */
+struct AnimationClock {
+  double base_time = 0.0;      // Timestamp at which `base_progress` was reached.
+  double base_progress = 0.0;  // Progress at `base_time`.
+  double speed = 1.0;          // Progress per second.
+  double last_time = 0.0;      // Timestamp of the previous tick.
+  double shown_progress = 0.0; // Progress returned by the previous tick.
+
+  uint64_t hitch_count = 0;    // Hitches seen since the plugin was loaded.
+};
+
+/**
+ * @brief The result of one clock tick.
+ */
+struct AnimationClockTick {
+  double progress = 0.0;   // Progress to show this frame (not clamped to 1).
+  double frame_time = 0.0; // Time since the previous tick.
+  bool hitch = false;      // `true` if `frame_time` exceeded the hitch threshold.
+};
+
+/**
+ * @brief (Re)starts the clock at `now`, at the given progress.
+ */
+void StartAnimationClock(AnimationClock& clock, double now, double speed, double progress = 0.0);
+
+/**
+ * @brief Changes the speed of a running clock without making the progress jump.
+ */
+void SetAnimationClockSpeed(AnimationClock& clock, double now, double speed);
+
+/**
+ * @brief Continues a clock that was not ticked for a while (e.g. the game was paused) from the
+ * progress it showed last, as if no time had passed since.
+ * @details A catch-up that was still in flight is dropped.
+ */
+void ResumeAnimationClock(AnimationClock& clock, double now);
+
+/**
+ * @brief Returns the progress to show for a frame at timestamp `now`.
+ */
+AnimationClockTick TickAnimationClock(AnimationClock& clock, double now, const AnimationClockSettings& settings);
+
+}  // namespace SPF_FrontalBlindspotViewer
@@ -0,0 +1,287 @@
+/**
+ * @file AnimationKernels.cpp
+ * @brief Implementation of the animation curve policies and the kernel selection.
+ */
+
+#include "AnimationKernels.hpp"
+#include <algorithm> // For std::clamp, std::min, std::max
+#include <cmath>     // For std::exp, std::fabs, std::log, std::sqrt
+#include <cstddef>   // For size_t
+#include <cstring>   // For std::strcmp
+
+namespace SPF_FrontalBlindspotViewer
+{
+
+    // =================================================================================================
+    // 1. Animation Type
+    // =================================================================================================
+
+    const char *AnimationTypeName(AnimationType type)
+    {
+        switch (type)
+        {
+        case AnimationType::Linear:
+            return "linear";
+        case AnimationType::Live:
+            return "live";
+        case AnimationType::Spring:
+            return "spring";
+        case AnimationType::Timeline:
+            return "timeline";
+        default:
+            return "live";
+        }
+    }
+
+    AnimationType ParseAnimationType(const char *name, AnimationType fallback)
+    {
+        for (uint8_t i = 0; i < static_cast<uint8_t>(AnimationType::Count); ++i)
+        {
+            AnimationType type = static_cast<AnimationType>(i);
+            if (std::strcmp(name, AnimationTypeName(type)) == 0)
+            {
+                return type;
+            }
+        }
+        return fallback;
+    }
+
+    // =================================================================================================
+    // 2. Curve Policies
+    // =================================================================================================
+
+    namespace
+    {
+        void PrepareOrientation(AnimationTrack &track)
+        {
+            if (track.shortest_rotation)
+                MakeOrientationTrack(track.start.rot[0], track.start.rot[1], track.end.rot[0], track.end.rot[1], track.orientation);
+            else
+                track.orientation = OrientationTrack();
+        }
+    } // namespace
+
+    void LinearCurve::Prepare(AnimationTrack &track)
+    {
+        track.duration = 0.0f;
+        PrepareOrientation(track);
+    }
+
+    void LinearCurve::Evaluate(const AnimationTrack &track, float p, CameraPose &out)
+    {
+        const CameraPose &s = track.start;
+        const CameraPose &e = track.end;
+        out.pos[0] = s.pos[0] + (e.pos[0] - s.pos[0]) * p;
+        out.pos[1] = s.pos[1] + (e.pos[1] - s.pos[1]) * p;
+        out.pos[2] = s.pos[2] + (e.pos[2] - s.pos[2]) * p;
+        out.rot[0] = s.rot[0] + (e.rot[0] - s.rot[0]) * p;
+        out.rot[1] = s.rot[1] + (e.rot[1] - s.rot[1]) * p;
+        out.fov = s.fov + (e.fov - s.fov) * p;
+        if (track.orientation.valid)
+            EvaluateOrientationTrack(track.orientation, p, out.rot[0], out.rot[1]);
+    }
+
+    void LiveCurve::Prepare(AnimationTrack &track)
+    {
+        track.duration = 0.0f;
+        BakeLivePath(MakeLivePath(track.start, track.end, track.towardsTarget), track.baked);
+    }
+
+    void LiveCurve::Evaluate(const AnimationTrack &track, float p, CameraPose &out)
+    {
+        SampleBakedPath(track.baked, p, out);
+    }
+
+    namespace
+    {
+        // The spring has settled once every channel is within 0.1% of its travel.
+        constexpr float kSpringSettleTolerance = 1e-3f;
+
+        // The smallest x = w*t at which the envelope (a + b x)e^(-x) of a channel with a = |c1|
+        // and b = |c2| / w is down to the tolerance of max(a, b); 9.2334 for a start at rest.
+        float SpringSettleOmegaT(float a, float b)
+        {
+            float scale = std::max(a, b);
+            if (scale <= 0.0f)
+                return 0.0f;
+            a /= scale;
+            b /= scale;
+
+            // Newton on ln(a + b x) - x = ln(tolerance), which is concave; starting right of the
+            // root it converges from above.
+            float x = 12.0f;
+            const float target = std::log(kSpringSettleTolerance);
+            for (int i = 0; i < 8; ++i)
+            {
+                float f = std::log(a + b * x) - x - target;
+                x -= f / (b / (a + b * x) - 1.0f);
+            }
+            return x;
+        }
+
+        // The distance of one channel from `end` at time t, with decay = e^(-wt) and u = t / T.
+        // The residual goes out with u^2, which leaves the start velocity untouched.
+        inline float SpringOffset(float c1, float c2, float residual, float t, float decay, float u)
+        {
+            return (c1 + c2 * t) * decay - residual * u * u;
+        }
+    } // namespace
+
+    void SpringCurve::Prepare(AnimationTrack &track)
+    {
+        SpringState &spring = track.spring;
+        float omega = std::sqrt(std::max(track.stiffness, 1.0f));
+        spring.omega = omega;
+
+        float settle = 0.0f;
+        bool moving = false;
+        for (int c = 0; c < kPoseChannelCount; ++c)
+        {
+            float c1 = GetPoseChannel(track.start, c) - GetPoseChannel(track.end, c);
+            float velocity = GetPoseChannel(spring.velocity, c);
+            float c2 = velocity + omega * c1;
+            SetPoseChannel(spring.c1, c, c1);
+            SetPoseChannel(spring.c2, c, c2);
+            settle = std::max(settle, SpringSettleOmegaT(std::fabs(c1), std::fabs(c2) / omega));
+            moving = moving || velocity != 0.0f;
+        }
+
+        // A track without travel still takes the time of one at rest.
+        if (settle <= 0.0f)
+            settle = SpringSettleOmegaT(1.0f, 1.0f);
+        track.duration = settle / omega;
+
+        float decay = std::exp(-settle);
+        for (int c = 0; c < kPoseChannelCount; ++c)
+        {
+            float left = (GetPoseChannel(spring.c1, c) + GetPoseChannel(spring.c2, c) * track.duration) * decay;
+            SetPoseChannel(spring.residual, c, left);
+        }
+
+        // Head turns in motion keep their own velocity per channel.
+        PrepareOrientation(track);
+        if (moving)
+            track.orientation = OrientationTrack();
+    }
+
+    void SpringCurve::Evaluate(const AnimationTrack &track, float p, CameraPose &out)
+    {
+        const SpringState &spring = track.spring;
+        const CameraPose &e = track.end;
+        float u = std::clamp(p, 0.0f, 1.0f);
+        float t = u * track.duration;
+        float decay = std::exp(-spring.omega * t);
+        out.pos[0] = e.pos[0] + SpringOffset(spring.c1.pos[0], spring.c2.pos[0], spring.residual.pos[0], t, decay, u);
+        out.pos[1] = e.pos[1] + SpringOffset(spring.c1.pos[1], spring.c2.pos[1], spring.residual.pos[1], t, decay, u);
+        out.pos[2] = e.pos[2] + SpringOffset(spring.c1.pos[2], spring.c2.pos[2], spring.residual.pos[2], t, decay, u);
+        out.rot[0] = e.rot[0] + SpringOffset(spring.c1.rot[0], spring.c2.rot[0], spring.residual.rot[0], t, decay, u);
+        out.rot[1] = e.rot[1] + SpringOffset(spring.c1.rot[1], spring.c2.rot[1], spring.residual.rot[1], t, decay, u);
+        out.fov = e.fov + SpringOffset(spring.c1.fov, spring.c2.fov, spring.residual.fov, t, decay, u);
+
+        if (track.orientation.valid)
+        {
+            // At rest every channel covers the same fraction of its travel.
+            float settle = spring.omega * track.duration;
+            float remaining = (1.0f + spring.omega * t) * decay - (1.0f + settle) * std::exp(-settle) * u * u;
+            EvaluateOrientationTrack(track.orientation, 1.0f - remaining, out.rot[0], out.rot[1]);
+        }
+    }
+
+    void TimelineCurve::Prepare(AnimationTrack &track)
+    {
+        track.duration = 0.0f;
+        track.timeline_cursor = TimelineCursor();
+    }
+
+    void TimelineCurve::Evaluate(const AnimationTrack &track, float p, CameraPose &out)
+    {
+        if (!track.timeline)
+        {
+            LinearCurve::Evaluate(track, p, out);
+            return;
+        }
+
+        if (track.towardsTarget)
+            EvaluateTimeline(*track.timeline, track.start, track.end, p, track.timeline_cursor, out);
+        else
+            EvaluateTimeline(*track.timeline, track.end, track.start, 1.0f - p, track.timeline_cursor, out);
+    }
+
+    // =================================================================================================
+    // 3. Kernel Selection
+    // =================================================================================================
+
+    const AnimationKernel &SelectAnimationKernel(AnimationType type)
+    {
+        static constexpr AnimationKernel kKernels[] = {
+            MakeAnimationKernel<LinearCurve>(), // AnimationType::Linear
+            MakeAnimationKernel<LiveCurve>(),   // AnimationType::Live
+            MakeAnimationKernel<SpringCurve>(), // AnimationType::Spring
+            MakeAnimationKernel<TimelineCurve>(), // AnimationType::Timeline
+        };
+        static_assert(sizeof(kKernels) / sizeof(kKernels[0]) == static_cast<size_t>(AnimationType::Count),
+                      "Every AnimationType needs a kernel");
+
+        uint8_t index = static_cast<uint8_t>(type);
+        return kKernels[index < static_cast<uint8_t>(AnimationType::Count) ? index : static_cast<uint8_t>(AnimationType::Live)];
+    }
+
+    // =================================================================================================
+    // 4. Track Evaluation
+    // =================================================================================================
+
+    namespace
+    {
+        // Progress step used to differentiate a track numerically.
+        constexpr float kVelocityStep = 1e-3f;
+
+        // out = (b - a) * k, channel by channel.
+        void Difference(const CameraPose &a, const CameraPose &b, float k, CameraPose &out)
+        {
+            for (int i = 0; i < 3; ++i)
+                out.pos[i] = (b.pos[i] - a.pos[i]) * k;
+            for (int i = 0; i < 2; ++i)
+                out.rot[i] = (b.rot[i] - a.rot[i]) * k;
+            out.fov = (b.fov - a.fov) * k;
+        }
+    } // namespace
+
+    void EvaluateTrack(const AnimationKernel &kernel, const AnimationTrack &track, float p, CameraPose &out)
+    {
+        kernel.Evaluate(track, p, out);
+
+        // Hermite basis h10(s) = s(1-s)^2.
+        float s = std::clamp(p, 0.0f, 1.0f);
+        float blend = s * (1.0f - s) * (1.0f - s);
+        const CameraPose &v = track.start_velocity;
+        for (int i = 0; i < 3; ++i)
+            out.pos[i] += v.pos[i] * blend;
+        for (int i = 0; i < 2; ++i)
+            out.rot[i] += v.rot[i] * blend;
+        out.fov += v.fov * blend;
+    }
+
+    void EvaluateTrackVelocity(const AnimationKernel &kernel, const AnimationTrack &track, float p, CameraPose &out)
+    {
+        float p0 = std::max(0.0f, p - kVelocityStep);
+        float p1 = std::min(1.0f, p + kVelocityStep);
+
+        CameraPose a, b;
+        EvaluateTrack(kernel, track, p0, a);
+        EvaluateTrack(kernel, track, p1, b);
+        Difference(a, b, 1.0f / (p1 - p0), out);
+    }
+
+    void SetTrackStartVelocity(const AnimationKernel &kernel, AnimationTrack &track, const CameraPose &velocity)
+    {
+        // Only add what the curve itself does not already provide at its start.
+        track.start_velocity = CameraPose();
+        if (kernel.carries_velocity)
+            return;
+        CameraPose curve_velocity;
+        EvaluateTrackVelocity(kernel, track, 0.0f, curve_velocity);
+
+        Difference(curve_velocity, velocity, 1.0f, track.start_velocity);
+    }
+
+} // namespace SPF_FrontalBlindspotViewer
@@ -0,0 +1,200 @@
+/**
+ * @file AnimationKernels.hpp
+ * @brief Compile-time specialized animation curves, selected once per animation.
+ *
+ * @details Every curve family is a small policy type with two static functions:
+ * `Prepare` runs once when an animation is triggered (e.g. baking the "live" path) and
+ * `Evaluate` runs every animated frame. `SelectAnimationKernel` turns the `AnimationType`
+ * parsed from the settings into a pair of plain function pointers, so the per-frame code
+ * performs one indirect call with no string handling, no branching on the type and no heap use.
+ *
+ * Adding a new curve family means adding an `AnimationType` value, its settings name and a
+ * policy type, and registering the policy in `SelectAnimationKernel`.
+ *
+ * This header is part of the `SPF_FrontalBlindspotViewer_Animation` library, which has no
+ * dependency on the SPF API and builds on every platform.
+ */
+#pragma once
+
+#include <cstdint> // For uint8_t
+
+#include "Orientation.hpp"  // For OrientationTrack
+#include "PeekPath.hpp"     // For CameraPose, LivePath and BakedPath
+#include "PeekTimeline.hpp" // For PeekTimeline and TimelineCursor
+
+namespace SPF_FrontalBlindspotViewer {
+
+// =================================================================================================
+// 1. Animation Type
+// =================================================================================================
+
+/**
+ * @brief The animation styles selectable through the `animation.type` setting.
+ */
+enum class AnimationType : uint8_t {
+  Linear = 0,
+  Live,
+  Spring,
+  Timeline,
+  Count
+};
+
+/**
+ * @brief Returns the settings value (`"linear"`, `"live"`, ...) for an animation type.
+ */
+const char* AnimationTypeName(AnimationType type);
+
+/**
+ * @brief Parses the `animation.type` settings value. Unknown values fall back to `fallback`.
+ */
+AnimationType ParseAnimationType(const char* name, AnimationType fallback);
+
+// =================================================================================================
+// 2. Animation Track & Curve Policies
+// =================================================================================================
+
+/**
+ * @brief The motion of `SpringCurve`, solved in `Prepare`.
+ * @details Every channel follows `x(t) = end + (c1 + c2 t)e^(-wt)` with `c1 = start - end` and
+ * `c2 = velocity + w c1`, so the spring carries its own start velocity.
+ */
+struct SpringState {
+  CameraPose velocity; // Per second at the start; set before `Prepare`, zero for a start at rest
+  float omega = 10.0f; // w = sqrt(stiffness)
+  CameraPose c1;
+  CameraPose c2;
+  CameraPose residual; // Left at t = T, faded out so the track ends exactly on `end`
+};
+
+/**
+ * @brief The immutable description of one running animation, filled in at trigger time.
+ */
+struct AnimationTrack {
+  CameraPose start;
+  CameraPose end;
+  bool towardsTarget = true; // `true` when animating from the seat to the peek pose.
+  float stiffness = 100.0f;  // Spring stiffness in 1/s^2, only used by `SpringCurve`.
+
+  // Seconds the curve takes, set by curves with their own time scale in `Prepare`.
+  // 0 means the duration follows `animation.speed`.
+  float duration = 0.0f;
+
+  // Extra pose change per unit of progress at p = 0, blended out over the track (see
+  // `EvaluateTrack`). It is zero for an animation that starts at rest.
+  CameraPose start_velocity;
+
+  BakedPath baked; // Only used by curves that bake themselves in `Prepare`.
+  SpringState spring; // Only used by `SpringCurve`.
+
+  // Turn the head along the shortest path (see `Orientation.hpp`) instead of moving yaw and pitch
+  // separately. Only used by the curves that move both at the same pace (`LinearCurve`,
+  // `SpringCurve`); their `Prepare` fills in `orientation`.
+  bool shortest_rotation = false;
+  OrientationTrack orientation;
+
+  // The keyframes of `TimelineCurve` (owned by the caller) and the segments it last looked at.
+  const PeekTimeline* timeline = nullptr;
+  mutable TimelineCursor timeline_cursor;
+};
+
+/**
+ * @brief Straight linear interpolation of every channel (of the orientation with `shortest_rotation`).
+ */
+struct LinearCurve {
+  static void Prepare(AnimationTrack& track);
+  static void Evaluate(const AnimationTrack& track, float p, CameraPose& out);
+};
+
+/**
+ * @brief The "live" Bezier arc, baked on trigger and fetched from the table every frame.
+ */
+struct LiveCurve {
+  static void Prepare(AnimationTrack& track);
+  static void Evaluate(const AnimationTrack& track, float p, CameraPose& out);
+};
+
+/**
+ * @brief A critically damped spring pulling every channel from `start` towards `end`.
+ *
+ * @details Uses the exact closed-form solution (see `SpringState`) with `w = sqrt(stiffness)`,
+ * evaluated directly at `t` rather than integrated, so it is stable at any frame time. Started at
+ * rest it cannot overshoot. Started with `spring.velocity` (e.g. turned around mid-flight) it
+ * carries that motion as a real spring would, instead of the generic start velocity blend of
+ * `EvaluateTrack`. The animation lasts until every channel is within 0.1% of its travel (`wT ~=
+ * 9.23` at rest), and the residual is removed so it still ends exactly on `end`; each frame costs
+ * one exponential. With `shortest_rotation` the head turns along the shortest path at the pace of
+ * the spring when it starts at rest.
+ */
+struct SpringCurve {
+  static constexpr bool kCarriesVelocity = true; // Starts with `spring.velocity`
+
+  static void Prepare(AnimationTrack& track);
+  static void Evaluate(const AnimationTrack& track, float p, CameraPose& out);
+};
+
+/**
+ * @brief Follows the keyframes of `track.timeline` (see `PeekTimeline.hpp`).
+ * @details The way back plays the timeline in reverse, from the seat's point of view, so a peek
+ * that looks up last looks down first on the way back. Without a timeline it is linear.
+ */
+struct TimelineCurve {
+  static void Prepare(AnimationTrack& track);
+  static void Evaluate(const AnimationTrack& track, float p, CameraPose& out);
+};
+
+// =================================================================================================
+// 3. Kernel Selection
+// =================================================================================================
+
+/**
+ * @brief The two entry points of an instantiated curve policy.
+ */
+struct AnimationKernel {
+  void (*Prepare)(AnimationTrack& track);
+  void (*Evaluate)(const AnimationTrack& track, float p, CameraPose& out);
+  bool carries_velocity = false; // The curve starts with `spring.velocity` itself (`kCarriesVelocity`)
+};
+
+/**
+ * @brief Instantiates the kernel for a curve policy.
+ */
+template <typename Curve>
+constexpr AnimationKernel MakeAnimationKernel() {
+  if constexpr (requires { Curve::kCarriesVelocity; })
+    return AnimationKernel{ &Curve::Prepare, &Curve::Evaluate, Curve::kCarriesVelocity };
+  else
+    return AnimationKernel{ &Curve::Prepare, &Curve::Evaluate };
+}
+
+/**
+ * @brief Returns the kernel for an animation type. Call this once, when the animation starts.
+ */
+const AnimationKernel& SelectAnimationKernel(AnimationType type);
+
+// =================================================================================================
+// 4. Track Evaluation
+// =================================================================================================
+
+/**
+ * @brief Evaluates a prepared track at progress `p`, including its start velocity.
+ * @details The start velocity is added with the Hermite basis `s(1-s)^2`, whose slope is 1 at
+ * the start and which is 0 with a slope of 0 at both ends. An interrupted animation therefore
+ * continues with its old velocity and still comes to rest exactly on `track.end`.
+ */
+void EvaluateTrack(const AnimationKernel& kernel, const AnimationTrack& track, float p, CameraPose& out);
+
+/**
+ * @brief The pose change per unit of progress of a prepared track at progress `p`.
+ */
+void EvaluateTrackVelocity(const AnimationKernel& kernel, const AnimationTrack& track, float p, CameraPose& out);
+
+/**
+ * @brief Makes a prepared track leave its start with `velocity` (per unit of progress).
+ * @details Call this after `kernel.Prepare`, once `start` and `end` are final. A kernel that
+ * `carries_velocity` was already given it (`spring.velocity`, per second) and gets no blend. Together with
+ * `EvaluateTrack` and `EvaluateTrackVelocity` this lets a running animation be resumed from any
+ * point of its curve: sample the pose and velocity there and start a new track from them.
+ */
+void SetTrackStartVelocity(const AnimationKernel& kernel, AnimationTrack& track, const CameraPose& velocity);
+
+}  // namespace SPF_FrontalBlindspotViewer
@@ -0,0 +1,63 @@
+/**
+ * @file AutoPeek.cpp
+ * @brief Implementation of the automatic peek's stop detector.
+ */
+
+#include "AutoPeek.hpp"
+#include <cmath> // For std::fabs
+
+namespace SPF_FrontalBlindspotViewer
+{
+
+    AutoPeekAction UpdateAutoPeekDetector(AutoPeekDetector &detector, const AutoPeekSample &sample, double now, const AutoPeekSettings &settings)
+    {
+        if (!settings.enabled)
+        {
+            bool was_peeking = detector.state == AutoPeekState::Peeking;
+            detector.state = AutoPeekState::Disarmed;
+            return was_peeking ? AutoPeekAction::Return : AutoPeekAction::None;
+        }
+
+        float speed = std::fabs(sample.speed);
+        bool moving = speed > settings.resume_speed;
+        bool throttle = sample.throttle >= settings.pedal_threshold;
+        bool standing = speed < settings.stop_speed && !throttle && (sample.brake >= settings.pedal_threshold || sample.parking_brake);
+
+        switch (detector.state)
+        {
+        case AutoPeekState::Disarmed:
+            if (moving)
+                detector.state = AutoPeekState::Armed;
+            break;
+        case AutoPeekState::Armed:
+            if (standing)
+            {
+                detector.state = AutoPeekState::Stopping;
+                detector.stopped_since = now;
+            }
+            break;
+        case AutoPeekState::Stopping:
+            if (!standing)
+            {
+                // Rolled on or released the brake before the dwell time: not a stop yet.
+                detector.state = AutoPeekState::Armed;
+            }
+            else if (now - detector.stopped_since >= settings.dwell_time)
+            {
+                detector.state = AutoPeekState::Peeking;
+                return AutoPeekAction::Peek;
+            }
+            break;
+        case AutoPeekState::Peeking:
+            // Releasing the brake alone keeps the peek; only driving off ends it.
+            if (moving || throttle)
+            {
+                detector.state = moving ? AutoPeekState::Armed : AutoPeekState::Disarmed;
+                return AutoPeekAction::Return;
+            }
+            break;
+        }
+        return AutoPeekAction::None;
+    }
+
+} // namespace SPF_FrontalBlindspotViewer
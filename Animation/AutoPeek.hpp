@@ -0,0 +1,120 @@
+/**
+ * @file AutoPeek.hpp
+ * @brief Detection of "stopped at the front of a queue" from truck telemetry, for the automatic peek.
+ *
+ * @details The truck data callback fires every frame, possibly on another thread than `OnUpdate`.
+ * It only packs the four values the detector needs into one 64-bit word and stores it in an
+ * atomic (`PackAutoPeekSample`), so the telemetry path costs a few instructions and never touches
+ * the plugin's state. The frame loop loads the latest word once per frame and runs the state
+ * machine in `UpdateAutoPeekDetector`:
+ *
+ * - `Armed` -> `Stopping` when the truck is slower than `stop_speed` with the brake or the
+ *   parking brake on and no throttle;
+ * - `Stopping` -> `Peeking` once that has lasted `dwell_time` without a break (the caller starts
+ *   the peek);
+ * - `Peeking` -> `Disarmed` as soon as the truck is faster than `resume_speed` or the throttle is
+ *   pressed (the caller brings the camera back);
+ * - `Disarmed` -> `Armed` once the truck has driven off (faster than `resume_speed`), so a blip of
+ *   the throttle at the stop line or a long stop does not start a second peek.
+ *
+ * The gap between the two speeds (hysteresis) keeps a truck creeping along in a queue from
+ * toggling the peek. The detector starts `Disarmed`, so loading a parked truck does not peek.
+ */
+#pragma once
+
+#include <bit>     // For std::bit_cast
+#include <cstdint> // For uint8_t, uint32_t, uint64_t
+
+namespace SPF_FrontalBlindspotViewer {
+
+// =================================================================================================
+// 1. Telemetry Sample
+// =================================================================================================
+
+/**
+ * @brief What the detector needs from one truck data update.
+ */
+struct AutoPeekSample {
+  float speed = 0.0f;    // m/s, negative when reversing
+  float brake = 0.0f;    // Brake pedal input, 0..1
+  float throttle = 0.0f; // Throttle pedal input, 0..1
+  bool parking_brake = false;
+};
+
+/**
+ * @brief Packs a sample into one word for an atomic store. Never returns 0, which means "no data".
+ * @details The speed keeps its float bits; the pedals are quantized to 1/255.
+ */
+inline uint64_t PackAutoPeekSample(const AutoPeekSample& sample) {
+  auto pedal = [](float value) -> uint64_t {
+    value = value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+    return static_cast<uint64_t>(value * 255.0f + 0.5f);
+  };
+  return std::bit_cast<uint32_t>(sample.speed) | pedal(sample.brake) << 32 | pedal(sample.throttle) << 40 |
+         static_cast<uint64_t>(sample.parking_brake) << 48 | uint64_t{1} << 63;
+}
+
+/**
+ * @brief The inverse of `PackAutoPeekSample`.
+ */
+inline AutoPeekSample UnpackAutoPeekSample(uint64_t word) {
+  AutoPeekSample sample;
+  sample.speed = std::bit_cast<float>(static_cast<uint32_t>(word));
+  sample.brake = static_cast<float>((word >> 32) & 0xFF) / 255.0f;
+  sample.throttle = static_cast<float>((word >> 40) & 0xFF) / 255.0f;
+  sample.parking_brake = ((word >> 48) & 1) != 0;
+  return sample;
+}
+
+// =================================================================================================
+// 2. Detector
+// =================================================================================================
+
+/**
+ * @brief User-tunable behaviour of the detector.
+ */
+struct AutoPeekSettings {
+  bool enabled = false;
+  float stop_speed = 2.0f / 3.6f;   // m/s (2 km/h); slower than this counts as standing
+  float resume_speed = 5.0f / 3.6f; // m/s (5 km/h); faster than this counts as driving again
+  float dwell_time = 1.5f;          // s the truck has to stand before the peek starts
+  float pedal_threshold = 0.1f;     // Brake and throttle count as pressed from here
+};
+
+enum class AutoPeekState : uint8_t {
+  Disarmed, // Waits for the truck to drive off
+  Armed,    // Driving; watches for a stop
+  Stopping, // Standing with the brake on, for less than the dwell time
+  Peeking   // The automatic peek is on
+};
+
+enum class AutoPeekAction : uint8_t {
+  None,
+  Peek,  // Start the peek
+  Return // Bring the camera back to the seat
+};
+
+/**
+ * @brief The state of the detector.
+ */
+struct AutoPeekDetector {
+  AutoPeekState state = AutoPeekState::Disarmed;
+  double stopped_since = 0.0; // Timestamp at which `Stopping` was entered
+};
+
+/**
+ * @brief Feeds the latest sample at frame timestamp `now` (seconds).
+ * @return What the caller should do with the camera this frame. Disabling the detector while it
+ * is `Peeking` returns `Return` once.
+ */
+AutoPeekAction UpdateAutoPeekDetector(AutoPeekDetector& detector, const AutoPeekSample& sample, double now,
+                                      const AutoPeekSettings& settings);
+
+/**
+ * @brief The user took over the camera: forget the current stop and wait for the next one.
+ */
+inline void DisarmAutoPeek(AutoPeekDetector& detector) {
+  detector.state = AutoPeekState::Disarmed;
+}
+
+}  // namespace SPF_FrontalBlindspotViewer
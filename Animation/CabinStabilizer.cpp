@@ -0,0 +1,127 @@
+/**
+ * @file CabinStabilizer.cpp
+ * @brief Implementation of the cabin-motion compensation filter.
+ */
+
+#include "CabinStabilizer.hpp"
+#include <algorithm> // For std::clamp
+#include <cmath>     // For std::fabs
+
+namespace SPF_FrontalBlindspotViewer
+{
+
+    namespace
+    {
+        constexpr float kTwoPi = 6.28318530718f;
+        constexpr float kSettled = 1e-9f; // Smaller differences are snapped, see below
+
+        // Smoothing factor of a first-order low-pass with the given cutoff (Hz) for a step of dt.
+        float LowPassAlpha(float cutoff, float dt)
+        {
+            float tau = 1.0f / (kTwoPi * cutoff);
+            return dt / (dt + tau);
+        }
+    } // namespace
+
+    void PublishCabinMotion(CabinMotionExchange &exchange, const CabinMotion &motion)
+    {
+        uint32_t sequence = exchange.sequence.load(std::memory_order_relaxed);
+        exchange.sequence.store(sequence + 1, std::memory_order_relaxed); // Odd: write in progress
+        std::atomic_thread_fence(std::memory_order_release);
+
+        uint8_t has_rate = 0;
+        for (int c = 0; c < kCabinChannelCount; ++c)
+        {
+            exchange.value[c].store(motion.value[c], std::memory_order_relaxed);
+            exchange.rate[c].store(motion.rate[c], std::memory_order_relaxed);
+            has_rate |= motion.has_rate[c] ? static_cast<uint8_t>(1u << c) : 0;
+        }
+        exchange.has_rate.store(has_rate, std::memory_order_relaxed);
+
+        exchange.sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    bool ReadCabinMotion(const CabinMotionExchange &exchange, CabinMotion &out)
+    {
+        uint32_t before = exchange.sequence.load(std::memory_order_acquire);
+        if (before == 0 || (before & 1) != 0)
+            return false;
+
+        CabinMotion motion;
+        uint8_t has_rate = exchange.has_rate.load(std::memory_order_relaxed);
+        for (int c = 0; c < kCabinChannelCount; ++c)
+        {
+            motion.value[c] = exchange.value[c].load(std::memory_order_relaxed);
+            motion.rate[c] = exchange.rate[c].load(std::memory_order_relaxed);
+            motion.has_rate[c] = (has_rate >> c) & 1;
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (exchange.sequence.load(std::memory_order_relaxed) != before)
+            return false; // Torn by a concurrent write; the next frame gets a clean one.
+
+        out = motion;
+        return true;
+    }
+
+    void UpdateCabinStabilizer(CabinStabilizer &stabilizer, const CabinMotion &motion, float dt, const CabinStabilizerSettings &settings)
+    {
+        if (!stabilizer.primed)
+        {
+            // Start from the current cabin position, so enabling the filter does not jolt the camera.
+            for (int c = 0; c < kCabinChannelCount; ++c)
+            {
+                OneEuroChannel &channel = stabilizer.channels[c];
+                channel.filtered = motion.value[c];
+                channel.previous = motion.value[c];
+                channel.speed = 0.0f;
+                stabilizer.correction[c] = 0.0f;
+            }
+            stabilizer.primed = true;
+            return;
+        }
+        if (dt <= 0.0f)
+            return;
+
+        float speed_alpha = LowPassAlpha(settings.derivative_cutoff, dt);
+        for (int c = 0; c < kCabinChannelCount; ++c)
+        {
+            OneEuroChannel &channel = stabilizer.channels[c];
+            float raw = motion.value[c];
+
+            // One-Euro: the faster the motion, the higher the cutoff, so a deliberate lean is
+            // followed quickly while the small oscillation around it is filtered out.
+            float speed = motion.has_rate[c] ? motion.rate[c] : (raw - channel.previous) / dt;
+            channel.speed += (speed - channel.speed) * speed_alpha;
+            float cutoff = settings.min_cutoff + settings.beta * std::fabs(channel.speed);
+            channel.filtered += (raw - channel.filtered) * LowPassAlpha(cutoff, dt);
+            channel.previous = raw;
+
+            // A still cabin would otherwise let the state decay into denormal floats (which never
+            // quite reach 0 and make every update many times slower).
+            if (std::fabs(channel.speed) < kSettled)
+                channel.speed = 0.0f;
+            if (std::fabs(raw - channel.filtered) < kSettled)
+                channel.filtered = raw;
+
+            // The camera moves against the fast part of the motion.
+            float limit = c < kCabinYaw ? settings.max_offset : settings.max_angle;
+            stabilizer.correction[c] = std::clamp((channel.filtered - raw) * settings.strength, -limit, limit);
+        }
+    }
+
+    void ResetCabinStabilizer(CabinStabilizer &stabilizer)
+    {
+        stabilizer = CabinStabilizer();
+    }
+
+    void ApplyCabinCorrection(const CabinStabilizer &stabilizer, float weight, CameraPose &pose)
+    {
+        pose.pos[0] += stabilizer.correction[kCabinX] * weight;
+        pose.pos[1] += stabilizer.correction[kCabinY] * weight;
+        pose.pos[2] += stabilizer.correction[kCabinZ] * weight;
+        pose.rot[0] += stabilizer.correction[kCabinYaw] * weight;
+        pose.rot[1] += stabilizer.correction[kCabinPitch] * weight;
+    }
+
+} // namespace SPF_FrontalBlindspotViewer
@@ -0,0 +1,120 @@
+/**
+ * @file CabinStabilizer.hpp
+ * @brief Counter-offsets the peek pose against cabin rock, so the view stays on the traffic light.
+ *
+ * @details The interior camera is attached to the cabin, and the cabin rocks on its suspension
+ * when the truck idles or brakes hard. The telemetry reports that motion as `cabin_offset`
+ * (cabin against chassis), `cabin_angular_velocity` and `head_offset` (the simulated head
+ * against the cabin). The stabilizer splits it into a slow part, which is kept (leaning into a
+ * hard stop is expected), and the fast rock, which is cancelled: every channel runs through a
+ * One-Euro filter (a low-pass whose cutoff rises with the speed of the motion) and the camera is
+ * moved by the difference between the raw and the filtered value, scaled by `strength` and
+ * clamped to a small range.
+ *
+ * The state is a fixed array of five channels; an update is O(1) and never allocates. The
+ * telemetry callback hands the motion over through a `CabinMotionExchange`, a seqlock of atomics
+ * that never blocks the writer.
+ */
+#pragma once
+
+#include <atomic>  // For std::atomic
+#include <cstdint> // For uint32_t
+
+#include "PeekPath.hpp" // For CameraPose
+
+namespace SPF_FrontalBlindspotViewer {
+
+// =================================================================================================
+// 1. Cabin Motion
+// =================================================================================================
+
+enum CabinChannel : int {
+  kCabinX = 0, kCabinY, kCabinZ, // Displacement in the camera's seat space, meters
+  kCabinYaw, kCabinPitch,        // Rotation, radians
+  kCabinChannelCount
+};
+
+/**
+ * @brief The cabin and head motion of one telemetry frame, in camera terms.
+ */
+struct CabinMotion {
+  float value[kCabinChannelCount] = {};
+  float rate[kCabinChannelCount] = {}; // Measured speed of change, if `has_rate`
+  bool has_rate[kCabinChannelCount] = {};
+};
+
+/**
+ * @brief Hands the latest `CabinMotion` from the telemetry callback to the frame loop.
+ * @details One writer, one reader. The writer never waits; a reader that races with a write
+ * keeps its previous value for that frame.
+ */
+struct CabinMotionExchange {
+  std::atomic<uint32_t> sequence{0}; // Odd while a write is in progress, 0 before the first
+  std::atomic<float> value[kCabinChannelCount] = {};
+  std::atomic<float> rate[kCabinChannelCount] = {};
+  std::atomic<uint8_t> has_rate{0}; // Bit per channel
+};
+
+/**
+ * @brief Writer side: publishes `motion`.
+ */
+void PublishCabinMotion(CabinMotionExchange& exchange, const CabinMotion& motion);
+
+/**
+ * @brief Reader side: copies the latest motion into `out`.
+ * @return `false` if nothing was published yet or a write was in progress (`out` is unchanged).
+ */
+bool ReadCabinMotion(const CabinMotionExchange& exchange, CabinMotion& out);
+
+// =================================================================================================
+// 2. Stabilizer
+// =================================================================================================
+
+/**
+ * @brief User-tunable behaviour of the stabilizer.
+ */
+struct CabinStabilizerSettings {
+  bool enabled = false;
+  float strength = 1.0f;          // 0 = off, 1 = cancel all of the fast motion
+  float min_cutoff = 0.3f;        // Hz; motion slower than this is kept
+  float beta = 0.5f;              // How much the cutoff rises with the speed of the motion
+  float derivative_cutoff = 1.0f; // Hz; smoothing of the estimated speed
+  float max_offset = 0.08f;       // Largest correction, meters
+  float max_angle = 0.05f;        // Largest correction, radians
+};
+
+/**
+ * @brief One filtered channel.
+ */
+struct OneEuroChannel {
+  float filtered = 0.0f;
+  float previous = 0.0f; // Last raw value, for the finite-difference speed
+  float speed = 0.0f;    // Smoothed speed of change
+};
+
+/**
+ * @brief The state of the stabilizer.
+ */
+struct CabinStabilizer {
+  OneEuroChannel channels[kCabinChannelCount];
+  float correction[kCabinChannelCount] = {}; // Added to the pose, see `ApplyCabinCorrection`
+  bool primed = false;                       // `false` until the first sample
+};
+
+/**
+ * @brief Feeds one sample taken `dt` seconds after the previous one and updates `correction`.
+ */
+void UpdateCabinStabilizer(CabinStabilizer& stabilizer, const CabinMotion& motion, float dt,
+                           const CabinStabilizerSettings& settings);
+
+/**
+ * @brief Forgets the history; the next sample primes the filters and yields no correction.
+ */
+void ResetCabinStabilizer(CabinStabilizer& stabilizer);
+
+/**
+ * @brief Adds `weight` times the current correction to `pose` (the FOV is left alone).
+ */
+void ApplyCabinCorrection(const CabinStabilizer& stabilizer, float weight, CameraPose& pose);
+
+}  // namespace SPF_FrontalBlindspotViewer
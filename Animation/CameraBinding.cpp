@@ -0,0 +1,59 @@
+/**
+ * @file CameraBinding.cpp
+ * @brief Implementation of the camera binding.
+ */
+
+#include "CameraBinding.hpp"
+#include <algorithm> // For std::min
+
+namespace SPF_FrontalBlindspotViewer
+{
+
+    void StartCameraBinding(CameraBinding &binding, double now)
+    {
+        binding = CameraBinding();
+        binding.started = now;
+        binding.next_probe = now;
+        binding.next_refresh = now + CameraBinding::kRefreshInterval;
+    }
+
+    void WakeCameraBinding(CameraBinding &binding, double now)
+    {
+        if (binding.bound)
+            return;
+
+        binding.next_probe = now;
+        binding.retry = CameraBinding::kFirstRetry;
+    }
+
+    CameraBindingAction ReportCameraProbe(CameraBinding &binding, double now, const CameraProbe &probe)
+    {
+        ++binding.probes;
+        if (probe.service_ready && probe.interior_ready)
+        {
+            binding.bound = true;
+            binding.time_to_ready = now - binding.started;
+            return CameraBindingAction::Bind;
+        }
+
+        binding.next_probe = now + binding.retry;
+        binding.retry = std::min(binding.retry * 2.0, CameraBinding::kMaxRetry);
+
+        // Without the service there is nothing to re-scan yet (e.g. still loading).
+        if (!probe.service_ready)
+            return CameraBindingAction::None;
+
+        if (now >= binding.next_refresh)
+        {
+            binding.next_refresh = now + CameraBinding::kRefreshInterval;
+            binding.next_probe = now; // See on the next frame whether the re-scan found it
+            ++binding.refreshes;
+            return CameraBindingAction::RefreshOffsets;
+        }
+
+        // Do not sleep through the moment a re-scan becomes allowed.
+        binding.next_probe = std::min(binding.next_probe, binding.next_refresh);
+        return CameraBindingAction::None;
+    }
+
+} // namespace SPF_FrontalBlindspotViewer
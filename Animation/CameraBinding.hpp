@@ -0,0 +1,93 @@
+/**
+ * @file CameraBinding.hpp
+ * @brief Confirms that the framework's camera service can reach the interior camera.
+ *
+ * @details The camera service finds the game's camera data by pattern search. After a game update
+ * a pattern may no longer match, and the `Cam_*` calls then silently write into nothing. The
+ * plugin therefore keeps the camera API unbound until a probe (`Cam_IsServiceReady` and
+ * `Cam_IsFinderReady(kInteriorCameraFinder)`) confirms it, and every camera path treats an unbound
+ * camera as "nothing to do".
+ *
+ * Probing is lazy: the first probe runs on the first frame after activation, then with
+ * exponential backoff (`kFirstRetry` doubling up to `kMaxRetry`), so a loading screen costs a
+ * handful of calls. `OnGameWorldReady` and every game state change (the end of a loading screen,
+ * a pause) reset the backoff and probe on the next frame. While the service is up but the
+ * interior camera is not found, `Cam_RefreshOffsets` (a heavy re-scan) is requested at most once
+ * per `kRefreshInterval`; the backoff never waits past the next allowed re-scan, and the frame
+ * after a re-scan probes again. Once bound, the camera is not probed again.
+ *
+ * This header is part of the `SPF_FrontalBlindspotViewer_Animation` library, which has no
+ * dependency on the SPF API and builds on every platform.
+ */
+#pragma once
+
+#include <cstdint> // For uint8_t, uint32_t
+
+namespace SPF_FrontalBlindspotViewer {
+
+/**
+ * @brief The camera service's finder for the interior camera (`Cam_IsFinderReady`).
+ */
+inline constexpr const char kInteriorCameraFinder[] = "InteriorCamera";
+
+/**
+ * @brief The answers of one probe of the camera service.
+ */
+struct CameraProbe {
+  bool service_ready = false;  // Cam_IsServiceReady
+  bool interior_ready = false; // Cam_IsFinderReady(kInteriorCameraFinder)
+};
+
+/**
+ * @brief What the caller should do after `ReportCameraProbe`.
+ */
+enum class CameraBindingAction : uint8_t {
+  None = 0,      // Not ready yet; wait for the next probe
+  Bind,          // Ready: bind the camera API
+  RefreshOffsets // The service is up without the interior camera: call Cam_RefreshOffsets
+};
+
+/**
+ * @brief The state of the binding; only touched on the frame thread.
+ */
+struct CameraBinding {
+  static constexpr double kFirstRetry = 0.25;      // Seconds until the second probe
+  static constexpr double kMaxRetry = 8.0;         // The backoff stops growing here
+  static constexpr double kRefreshInterval = 30.0; // Seconds between two Cam_RefreshOffsets
+
+  bool bound = false;
+  double started = 0.0;       // When the binding started (activation)
+  double next_probe = 0.0;    // Earliest time of the next probe
+  double retry = kFirstRetry; // Wait after the next failed probe
+  double next_refresh = 0.0;  // Earliest time of the next offset refresh
+  double time_to_ready = -1.0; // Seconds from `started` until bound, -1 until then
+  uint32_t probes = 0;
+  uint32_t refreshes = 0;
+  uint32_t game_states = 0;   // CameraGate::changes last seen; a new one wakes the binding
+};
+
+/**
+ * @brief Starts unbound; the first probe is due right away, the first refresh only after
+ * `kRefreshInterval` (the service usually finds the camera on its own while the game loads).
+ */
+void StartCameraBinding(CameraBinding& binding, double now);
+
+/**
+ * @brief The game world is loaded or the game state changed: probe on the next frame and
+ * restart the backoff. Does nothing once bound.
+ */
+void WakeCameraBinding(CameraBinding& binding, double now);
+
+/**
+ * @brief `true` if the camera is unbound and a probe is due.
+ */
+inline bool CameraBindingWantsProbe(const CameraBinding& binding, double now) {
+  return !binding.bound && now >= binding.next_probe;
+}
+
+/**
+ * @brief Records a probe made at `now` and schedules the next one.
+ */
+CameraBindingAction ReportCameraProbe(CameraBinding& binding, double now, const CameraProbe& probe);
+
+}  // namespace SPF_FrontalBlindspotViewer
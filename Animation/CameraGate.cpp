@@ -0,0 +1,48 @@
+/**
+ * @file CameraGate.cpp
+ * @brief Implementation of the camera gate.
+ */
+
+#include "CameraGate.hpp"
+
+namespace SPF_FrontalBlindspotViewer
+{
+
+    void PublishGameState(CameraGate &gate, bool paused, float scale)
+    {
+        // A time scale of zero stops the simulation just like the pause menu.
+        bool stopped = paused || !(scale > 0.0f);
+        bool was_stopped = gate.paused.exchange(stopped, std::memory_order_relaxed);
+        float previous_scale = gate.scale.exchange(scale, std::memory_order_relaxed);
+        if (stopped != was_stopped || scale != previous_scale)
+            gate.changes.fetch_add(1, std::memory_order_release);
+    }
+
+    bool CameraGateWantsQuery(CameraGate &gate, bool wanted, double now)
+    {
+        if (gate.paused.load(std::memory_order_relaxed))
+            return false; // Closed anyway; the change back to running asks again
+
+        // Closed by another camera: nothing else would notice the interior camera coming back.
+        bool closed_poll = !gate.open && now >= gate.next_closed_query;
+        uint32_t changes = gate.changes.load(std::memory_order_acquire);
+        if (!wanted && !closed_poll && changes == gate.seen_changes)
+            return false;
+
+        gate.seen_changes = changes;
+        gate.next_closed_query = now + CameraGate::kClosedQueryInterval;
+        ++gate.queries;
+        return true;
+    }
+
+    CameraGateEvent UpdateCameraGate(CameraGate &gate)
+    {
+        bool open = gate.interior && !gate.paused.load(std::memory_order_relaxed);
+        if (open == gate.open)
+            return CameraGateEvent::None;
+
+        gate.open = open;
+        return open ? CameraGateEvent::Opened : CameraGateEvent::Closed;
+    }
+
+} // namespace SPF_FrontalBlindspotViewer
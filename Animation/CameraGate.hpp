@@ -0,0 +1,72 @@
+/**
+ * @file CameraGate.hpp
+ * @brief Decides whether the plugin may touch the interior camera this frame.
+ *
+ * @details Writing the interior seat, head and FOV only makes sense while the interior camera is
+ * the one being shown and the game is running. The gate is closed while the game is paused or its
+ * time scale is zero (the game state callback stores this in atomics, so the telemetry path never
+ * touches the plugin's state) or while another camera is active. The active camera is asked for
+ * with `Cam_GetCurrentCamera` every frame while the plugin is moving or holding the camera, and
+ * otherwise only after a game state change or right before a peek starts. An idle plugin does not
+ * ask while the gate is open; while it is closed by another camera it asks every
+ * `kClosedQueryInterval`, so switching back to the interior camera opens it again.
+ *
+ * `UpdateCameraGate` reports each change once (`Closed`, `Opened`), so the plugin can freeze a
+ * running animation and continue it, and rewrite its pose, when the camera comes back. A closed
+ * gate costs the frame loop one branch.
+ */
+#pragma once
+
+#include <atomic>  // For std::atomic
+#include <cstdint> // For uint8_t, uint64_t
+
+namespace SPF_FrontalBlindspotViewer {
+
+/**
+ * @brief What changed in the last `UpdateCameraGate`.
+ */
+enum class CameraGateEvent : uint8_t {
+  None = 0,
+  Closed, // The camera is no longer live; stop writing it
+  Opened  // The camera is live again; continue and rewrite the pose
+};
+
+/**
+ * @brief The state of the gate. Only `paused`, `scale` and `changes` are written from outside the
+ * frame loop.
+ */
+struct CameraGate {
+  static constexpr double kClosedQueryInterval = 0.25; // Seconds between queries while closed and idle
+
+  std::atomic<bool> paused{false};    // Paused or stopped (time scale 0), set by the game state callback
+  std::atomic<float> scale{1.0f};     // Game time scale of the last game state
+  std::atomic<uint32_t> changes{0};   // Bumped by the game state callback when either changes
+  uint32_t seen_changes = 0;          // `changes` as of the last query
+  bool interior = true;               // The interior camera was active at the last query
+  bool open = true;                   // As of the last `UpdateCameraGate`
+  double next_closed_query = 0.0;     // Earliest idle query while closed by another camera
+  uint64_t queries = 0;               // Camera queries made
+};
+
+/**
+ * @brief Called from the game state callback with its `paused` and `scale`.
+ */
+void PublishGameState(CameraGate& gate, bool paused, float scale);
+
+/**
+ * @brief `true` if the active camera should be queried this frame; the caller then stores the
+ * answer in `gate.interior`.
+ * @param wanted The plugin is animating, peeking or holding, or about to start, so the answer
+ * matters now. Without it, a game state change since the last query asks again, and so does a
+ * gate closed by another camera once `kClosedQueryInterval` has passed. A paused game is never
+ * asked about: the gate is closed whatever the camera.
+ * @param now The frame timestamp, in seconds.
+ */
+bool CameraGateWantsQuery(CameraGate& gate, bool wanted, double now);
+
+/**
+ * @brief Opens or closes the gate from `paused` and `interior` and reports the change.
+ */
+CameraGateEvent UpdateCameraGate(CameraGate& gate);
+
+}  // namespace SPF_FrontalBlindspotViewer
@@ -0,0 +1,71 @@
+/**
+ * @file CameraWriter.cpp
+ * @brief Implementation of the camera output dirty tracking.
+ */
+
+#include "CameraWriter.hpp"
+#include <cmath> // For std::fabs
+
+namespace SPF_FrontalBlindspotViewer
+{
+
+    namespace
+    {
+        // Returns true if any of the `count` channels moved by more than `epsilon`.
+        bool HasChanged(const float *last, const float *next, int count, float epsilon)
+        {
+            for (int i = 0; i < count; ++i)
+            {
+                if (std::fabs(next[i] - last[i]) > epsilon)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void Remember(float *last, const float *next, int count)
+        {
+            for (int i = 0; i < count; ++i)
+            {
+                last[i] = next[i];
+            }
+        }
+    } // namespace
+
+    void InvalidateCameraWriteCache(CameraWriteCache &cache)
+    {
+        cache.valid = 0;
+    }
+
+    uint8_t CollectCameraWrites(CameraWriteCache &cache, const CameraPose &pose, bool exact)
+    {
+        // An exact write still skips calls whose values are bit-for-bit the same.
+        const float epsilon = exact ? 0.0f : cache.epsilon;
+        uint8_t writes = 0;
+
+        if (!(cache.valid & kWriteSeatPos) || HasChanged(cache.last.pos, pose.pos, 3, epsilon))
+        {
+            Remember(cache.last.pos, pose.pos, 3);
+            writes |= kWriteSeatPos;
+        }
+        if (!(cache.valid & kWriteHeadRot) || HasChanged(cache.last.rot, pose.rot, 2, epsilon))
+        {
+            Remember(cache.last.rot, pose.rot, 2);
+            writes |= kWriteHeadRot;
+        }
+        if (!(cache.valid & kWriteFov) || HasChanged(&cache.last.fov, &pose.fov, 1, epsilon))
+        {
+            cache.last.fov = pose.fov;
+            writes |= kWriteFov;
+        }
+
+        cache.valid |= writes;
+
+        int made = ((writes & kWriteSeatPos) != 0) + ((writes & kWriteHeadRot) != 0) + ((writes & kWriteFov) != 0);
+        cache.stats.calls_made += made;
+        cache.stats.calls_skipped += 3 - made;
+        return writes;
+    }
+
+} // namespace SPF_FrontalBlindspotViewer
@@ -0,0 +1,64 @@
+/**
+ * @file CameraWriter.hpp
+ * @brief Dirty tracking for the interior camera output.
+ *
+ * @details Every `Cam_SetInterior*` call patches the game's camera objects, so the output stage
+ * remembers the last value handed to each call and only reports a call as needed when one of its
+ * channels moved by more than an epsilon. The comparison is always made against the last value
+ * that was actually written, so slow drifts below the epsilon still accumulate into a write.
+ *
+ * The cache only decides *which* calls to make; issuing them is left to the plugin, which keeps
+ * this header free of any SPF dependency.
+ */
+#pragma once
+
+#include <cstdint> // For uint8_t, uint64_t
+
+#include "PeekPath.hpp" // For CameraPose
+
+namespace SPF_FrontalBlindspotViewer {
+
+/**
+ * @brief The camera setter calls the output stage can make, as bit flags.
+ */
+enum CameraWrite : uint8_t {
+  kWriteSeatPos = 1 << 0, // Cam_SetInteriorSeatPos
+  kWriteHeadRot = 1 << 1, // Cam_SetInteriorHeadRot
+  kWriteFov = 1 << 2,     // Cam_SetInteriorFov
+  kWriteAll = kWriteSeatPos | kWriteHeadRot | kWriteFov
+};
+
+/**
+ * @brief How many setter calls were made and how many were skipped as redundant.
+ */
+struct CameraWriteStats {
+  uint64_t calls_made = 0;
+  uint64_t calls_skipped = 0;
+};
+
+/**
+ * @brief The last written pose and the bookkeeping needed to diff the next one against it.
+ */
+struct CameraWriteCache {
+  CameraPose last;          // The values last handed to each setter call.
+  uint8_t valid = 0;        // `CameraWrite` flags whose `last` value reflects the game's camera.
+  float epsilon = 1e-4f;    // Smallest per-channel change that is worth a call.
+  CameraWriteStats stats;
+};
+
+/**
+ * @brief Forgets the last written values, so the next pose is written in full.
+ * @details Call this whenever something other than the plugin may have moved the camera, e.g.
+ * when a new peek starts.
+ */
+void InvalidateCameraWriteCache(CameraWriteCache& cache);
+
+/**
+ * @brief Decides which setter calls `pose` needs and records them as written.
+ * @param exact When `true`, any difference counts as a change (used for the final snap, so the
+ *        camera ends exactly on the target pose).
+ * @return The `CameraWrite` flags of the calls to make.
+ */
+uint8_t CollectCameraWrites(CameraWriteCache& cache, const CameraPose& pose, bool exact = false);
+
+}  // namespace SPF_FrontalBlindspotViewer
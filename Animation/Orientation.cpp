@@ -0,0 +1,145 @@
+/**
+ * @file Orientation.cpp
+ * @brief Implementation of the quaternion head rotation.
+ */
+
+#include "Orientation.hpp"
+#include <algorithm> // For std::clamp, std::min
+#include <cmath>     // For std::sin, std::cos, std::acos, std::atan2, std::asin, std::sqrt, std::fabs, std::nearbyint
+
+namespace SPF_FrontalBlindspotViewer
+{
+
+    namespace
+    {
+        constexpr float kPi = 3.14159265359f;
+        constexpr float kTwoPi = 6.28318530718f;
+
+        float Dot(const Quaternion &a, const Quaternion &b)
+        {
+            return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+        }
+
+        Quaternion Scale(const Quaternion &q, float k)
+        {
+            Quaternion out;
+            out.x = q.x * k;
+            out.y = q.y * k;
+            out.z = q.z * k;
+            out.w = q.w * k;
+            return out;
+        }
+
+        // Scales a blend of two unit quaternions back onto the unit sphere.
+        Quaternion Normalize(const Quaternion &q)
+        {
+            return Scale(q, 1.0f / std::sqrt(Dot(q, q)));
+        }
+
+        // a * wa + b * wb, component by component.
+        Quaternion Blend(const Quaternion &a, float wa, const Quaternion &b, float wb)
+        {
+            Quaternion q;
+            q.x = a.x * wa + b.x * wb;
+            q.y = a.y * wa + b.y * wb;
+            q.z = a.z * wa + b.z * wb;
+            q.w = a.w * wa + b.w * wb;
+            return q;
+        }
+    } // namespace
+
+    // =================================================================================================
+    // 1. Quaternions
+    // =================================================================================================
+
+    Quaternion QuaternionFromYawPitch(float yaw, float pitch)
+    {
+        // q = yaw about Y, then pitch about the turned X axis.
+        float sy = std::sin(yaw * 0.5f), cy = std::cos(yaw * 0.5f);
+        float sp = std::sin(pitch * 0.5f), cp = std::cos(pitch * 0.5f);
+        Quaternion q;
+        q.x = cy * sp;
+        q.y = sy * cp;
+        q.z = -sy * sp;
+        q.w = cy * cp;
+        return q;
+    }
+
+    void YawPitchFromQuaternion(const Quaternion &q, float &yaw, float &pitch)
+    {
+        // The view direction: (0, 0, -1) rotated by q.
+        float dx = -2.0f * (q.w * q.y + q.z * q.x);
+        float dy = 2.0f * (q.w * q.x - q.z * q.y);
+        float dz = -1.0f + 2.0f * (q.x * q.x + q.y * q.y);
+        yaw = std::atan2(-dx, -dz);
+        pitch = std::asin(std::clamp(dy, -1.0f, 1.0f));
+    }
+
+    Quaternion Slerp(const Quaternion &a, const Quaternion &b, float t)
+    {
+        float d = Dot(a, b);
+        Quaternion to = d < 0.0f ? Scale(b, -1.0f) : b;
+        d = std::fabs(d);
+        if (d > 0.9999f)
+        {
+            return Normalize(Blend(a, 1.0f - t, to, t));
+        }
+        float angle = std::acos(d);
+        float inv_sin = 1.0f / std::sin(angle);
+        return Blend(a, std::sin((1.0f - t) * angle) * inv_sin, to, std::sin(t * angle) * inv_sin);
+    }
+
+    // =================================================================================================
+    // 2. Orientation Track
+    // =================================================================================================
+
+    void MakeOrientationTrack(float from_yaw, float from_pitch, float to_yaw, float to_pitch, OrientationTrack &out)
+    {
+        out = OrientationTrack();
+        out.from_yaw = from_yaw;
+        out.from_pitch = from_pitch;
+        out.to_yaw = to_yaw;
+        out.to_pitch = to_pitch;
+        if (!(std::fabs(to_yaw - from_yaw) < kPi)) // Also rejects NaN
+            return;
+
+        out.from = QuaternionFromYawPitch(from_yaw, from_pitch);
+        out.to = QuaternionFromYawPitch(to_yaw, to_pitch);
+        float d = Dot(out.from, out.to);
+        if (d < 0.0f)
+        {
+            out.to = Scale(out.to, -1.0f);
+            d = -d;
+        }
+        out.angle = std::acos(std::min(d, 1.0f));
+        out.inv_sin_angle = out.angle >= OrientationTrack::kNlerpMaxAngle ? 1.0f / std::sin(out.angle) : 0.0f;
+        out.valid = true;
+    }
+
+    void EvaluateOrientationTrack(const OrientationTrack &track, float u, float &yaw, float &pitch)
+    {
+        if (u <= 0.0f || u >= 1.0f)
+        {
+            yaw = u <= 0.0f ? track.from_yaw : track.to_yaw;
+            pitch = u <= 0.0f ? track.from_pitch : track.to_pitch;
+            return;
+        }
+
+        Quaternion q;
+        if (track.angle < OrientationTrack::kNlerpMaxAngle)
+        {
+            q = Normalize(Blend(track.from, 1.0f - u, track.to, u));
+        }
+        else
+        {
+            q = Blend(track.from, std::sin((1.0f - u) * track.angle) * track.inv_sin_angle,
+                      track.to, std::sin(u * track.angle) * track.inv_sin_angle);
+        }
+        YawPitchFromQuaternion(q, yaw, pitch);
+
+        // Unwrap the yaw next to where the two-angle interpolation would be, which may lie outside -pi..pi.
+        float reference = track.from_yaw + (track.to_yaw - track.from_yaw) * u;
+        yaw += kTwoPi * std::nearbyint((reference - yaw) / kTwoPi);
+    }
+
+} // namespace SPF_FrontalBlindspotViewer
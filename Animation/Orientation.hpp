@@ -0,0 +1,89 @@
+/**
+ * @file Orientation.hpp
+ * @brief Head rotation interpolated as one orientation (a quaternion) instead of two angles.
+ *
+ * @details Moving yaw and pitch independently is fine for small head turns, but for a large
+ * turn combined with a look up the head takes a detour: the rotation keeps changing its axis on
+ * the way. A slerp turns the head about one fixed axis at a constant rate, which is the shortest
+ * rotation between the two poses. An `OrientationTrack` converts both ends to quaternions once,
+ * when the animation is prepared, and every frame interpolates between them: a normalized lerp
+ * while the two orientations are close (it stays within 1e-5 rad of the exact slerp there), the
+ * exact slerp with a precomputed 1/sin otherwise. The result goes back to the yaw/pitch pair the
+ * interior camera API takes, with the yaw unwrapped next to the angle the two-angle
+ * interpolation would give, so it never jumps by a full turn.
+ *
+ * The interior camera has no roll, and `Cam_SetInteriorHeadRot` only takes yaw and pitch, so the
+ * orientations here have no roll either. A yaw change of half a turn or more cannot be animated
+ * along the shortest arc without turning the other way round; such a track is left invalid and
+ * the caller keeps the two-angle interpolation.
+ *
+ * This header is part of the `SPF_FrontalBlindspotViewer_Animation` library, which has no
+ * dependency on the SPF API and builds on every platform.
+ */
+#pragma once
+
+namespace SPF_FrontalBlindspotViewer {
+
+// =================================================================================================
+// 1. Quaternions
+// =================================================================================================
+
+/**
+ * @brief A rotation quaternion. The camera looks down -Z with +Y up; yaw turns about Y, pitch about X.
+ */
+struct Quaternion {
+  float x = 0.0f;
+  float y = 0.0f;
+  float z = 0.0f;
+  float w = 1.0f;
+};
+
+/**
+ * @brief The orientation of a head turned by `yaw` and then tilted by `pitch` (radians).
+ */
+Quaternion QuaternionFromYawPitch(float yaw, float pitch);
+
+/**
+ * @brief The yaw (-pi..pi) and pitch (-pi/2..pi/2) of the view direction of `q`; roll is dropped.
+ */
+void YawPitchFromQuaternion(const Quaternion& q, float& yaw, float& pitch);
+
+/**
+ * @brief Spherical linear interpolation along the shorter arc from `a` to `b`.
+ */
+Quaternion Slerp(const Quaternion& a, const Quaternion& b, float t);
+
+// =================================================================================================
+// 2. Orientation Track
+// =================================================================================================
+
+/**
+ * @brief The head rotation of one animation, prepared for per-frame interpolation.
+ */
+struct OrientationTrack {
+  // Below this angle between the two quaternions (half the head turn) the track uses nlerp.
+  static constexpr float kNlerpMaxAngle = 0.05f;
+
+  Quaternion from;
+  Quaternion to;            // On the same hemisphere as `from`, so the shorter arc is taken
+  float angle = 0.0f;       // Between `from` and `to`
+  float inv_sin_angle = 0.0f;
+  float from_yaw = 0.0f;    // The exact end points, returned at u = 0 and u = 1
+  float from_pitch = 0.0f;
+  float to_yaw = 0.0f;
+  float to_pitch = 0.0f;
+  bool valid = false;       // `false`: interpolate yaw and pitch separately instead
+};
+
+/**
+ * @brief Prepares the rotation from (`from_yaw`, `from_pitch`) to (`to_yaw`, `to_pitch`).
+ * @details Leaves the track invalid if the yaw changes by half a turn or more.
+ */
+void MakeOrientationTrack(float from_yaw, float from_pitch, float to_yaw, float to_pitch, OrientationTrack& out);
+
+/**
+ * @brief The yaw and pitch at `u` (0 = from, 1 = to; ends are exact) of a valid track.
+ */
+void EvaluateOrientationTrack(const OrientationTrack& track, float u, float& yaw, float& pitch);
+
+}  // namespace SPF_FrontalBlindspotViewer
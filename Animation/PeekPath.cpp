@@ -0,0 +1,209 @@
+/**
+ * @file PeekPath.cpp
+ * @brief Implementation of the "live" peek path and its baked sample table.
+ */
+
+#include "PeekPath.hpp"
+#include <algorithm> // For std::clamp, std::min
+#include <cmath>     // For std::pow, std::fmax, std::sqrt
+
+namespace SPF_FrontalBlindspotViewer
+{
+
+    // =================================================================================================
+    // 1. Pose Types
+    // =================================================================================================
+
+    CameraPose MakeCameraPose(const float pos[3], const float rot[2], float fov)
+    {
+        CameraPose pose;
+        pose.pos[0] = pos[0];
+        pose.pos[1] = pos[1];
+        pose.pos[2] = pos[2];
+        pose.rot[0] = rot[0];
+        pose.rot[1] = rot[1];
+        pose.fov = fov;
+        return pose;
+    }
+
+    float GetPoseChannel(const CameraPose &pose, int channel)
+    {
+        if (channel < kYaw)
+            return pose.pos[channel];
+        if (channel < kFov)
+            return pose.rot[channel - kYaw];
+        return pose.fov;
+    }
+
+    void SetPoseChannel(CameraPose &pose, int channel, float value)
+    {
+        if (channel < kYaw)
+            pose.pos[channel] = value;
+        else if (channel < kFov)
+            pose.rot[channel - kYaw] = value;
+        else
+            pose.fov = value;
+    }
+
+    void ScalePose(CameraPose &pose, float k)
+    {
+        for (int i = 0; i < 3; ++i)
+            pose.pos[i] *= k;
+        for (int i = 0; i < 2; ++i)
+            pose.rot[i] *= k;
+        pose.fov *= k;
+    }
+
+    // =================================================================================================
+    // 2. Arc Length
+    // =================================================================================================
+
+    void BuildArcLengthTable(const float (&points)[ArcLengthTable::kSamples][3], ArcLengthTable &out)
+    {
+        float total = 0.0f;
+        out.distance[0] = 0.0f;
+        for (int i = 1; i < ArcLengthTable::kSamples; ++i)
+        {
+            float dx = points[i][0] - points[i - 1][0];
+            float dy = points[i][1] - points[i - 1][1];
+            float dz = points[i][2] - points[i - 1][2];
+            total += std::sqrt(dx * dx + dy * dy + dz * dz);
+            out.distance[i] = total;
+        }
+
+        if (!(total > 1e-6f)) // Also catches NaN
+        {
+            for (int i = 0; i < ArcLengthTable::kSamples; ++i)
+                out.distance[i] = static_cast<float>(i) / ArcLengthTable::kSegments;
+            return;
+        }
+        for (int i = 1; i < ArcLengthTable::kSegments; ++i)
+            out.distance[i] /= total;
+        out.distance[ArcLengthTable::kSegments] = 1.0f;
+    }
+
+    float ParameterAtDistance(const ArcLengthTable &table, float s)
+    {
+        s = std::clamp(s, 0.0f, 1.0f);
+
+        // Find the last segment that starts at or before s; each step compiles to a conditional move.
+        int i = 0;
+        for (int step = ArcLengthTable::kSegments / 2; step > 0; step /= 2)
+            i += table.distance[i + step] <= s ? step : 0; // At most kSegments - 1
+
+        float a = table.distance[i];
+        float length = table.distance[i + 1] - a;
+        float f = length > 0.0f ? (s - a) / length : 0.0f;
+        return (static_cast<float>(i) + f) / ArcLengthTable::kSegments;
+    }
+
+    // =================================================================================================
+    // 3. Analytic "Live" Path
+    // =================================================================================================
+
+    float EaseInOutCubic(float t)
+    {
+        return t < 0.5 ? 4 * t * t * t : 1 - std::pow(-2 * t + 2, 3) / 2;
+    }
+
+    float QuadraticBezier(float t, float p0, float p1, float p2)
+    {
+        float one_minus_t = 1.0f - t;
+        return one_minus_t * one_minus_t * p0 + 2.0f * one_minus_t * t * p1 + t * t * p2;
+    }
+
+    LivePath MakeLivePath(const CameraPose &start, const CameraPose &end, bool towardsTarget)
+    {
+        LivePath path;
+        path.start = start;
+        path.end = end;
+
+        // P0 is the start point, P2 is the end point and P1 is the control point that
+        // "pulls" the curve into an arc instead of moving along straight axes.
+        float horizontal_factor = towardsTarget ? 0.2f : 0.8f;
+        path.control[0] = start.pos[0] + (end.pos[0] - start.pos[0]) * horizontal_factor;
+        path.control[2] = start.pos[2] + (end.pos[2] - start.pos[2]) * horizontal_factor;
+
+        // Use the arc height fine-tuned by the user.
+        path.control[1] = std::fmax(start.pos[1], end.pos[1]) + 0.15f;
+
+        float points[ArcLengthTable::kSamples][3];
+        for (int i = 0; i < ArcLengthTable::kSamples; ++i)
+        {
+            float t = static_cast<float>(i) / ArcLengthTable::kSegments;
+            for (int axis = 0; axis < 3; ++axis)
+                points[i][axis] = QuadraticBezier(t, start.pos[axis], path.control[axis], end.pos[axis]);
+        }
+        BuildArcLengthTable(points, path.arc);
+        return path;
+    }
+
+    void EvaluateLivePath(const LivePath &path, float p, CameraPose &out)
+    {
+        const CameraPose &s = path.start;
+        const CameraPose &e = path.end;
+
+        // A single, consistent easing for the entire animation path
+        float eased_p = EaseInOutCubic(p);
+
+        // --- POSITION: Calculated along a Quadratic Bezier Curve ---
+        // The easing sets the distance travelled along the arc, not the Bezier parameter.
+        float arc_t = ParameterAtDistance(path.arc, eased_p);
+        out.pos[0] = QuadraticBezier(arc_t, s.pos[0], path.control[0], e.pos[0]);
+        out.pos[1] = QuadraticBezier(arc_t, s.pos[1], path.control[1], e.pos[1]);
+        out.pos[2] = QuadraticBezier(arc_t, s.pos[2], path.control[2], e.pos[2]);
+
+        // --- ROTATION ---
+        // Yaw (left/right rotation) follows the main eased progress.
+        out.rot[0] = s.rot[0] + (e.rot[0] - s.rot[0]) * eased_p;
+
+        // Pitch (up/down rotation) for looking up at the end of the movement.
+        float lookup_progress = std::fmax(0.0f, (p - 0.7f) / 0.3f);
+        out.rot[1] = s.rot[1] + (e.rot[1] - s.rot[1]) * (lookup_progress * lookup_progress);
+
+        // --- FOV ---
+        // Field of View animation remains linear for simplicity.
+        out.fov = s.fov + (e.fov - s.fov) * p;
+    }
+
+    // =================================================================================================
+    // 4. Baked Path
+    // =================================================================================================
+
+    void BakeLivePath(const LivePath &path, BakedPath &out)
+    {
+        CameraPose pose;
+        for (int i = 0; i < BakedPath::kSampleCount; ++i)
+        {
+            EvaluateLivePath(path, static_cast<float>(i) / BakedPath::kIntervals, pose);
+            out.samples[kPosX][i] = pose.pos[0];
+            out.samples[kPosY][i] = pose.pos[1];
+            out.samples[kPosZ][i] = pose.pos[2];
+            out.samples[kYaw][i] = pose.rot[0];
+            out.samples[kPitch][i] = pose.rot[1];
+            out.samples[kFov][i] = pose.fov;
+        }
+    }
+
+    void SampleBakedPath(const BakedPath &baked, float p, CameraPose &out)
+    {
+        float x = std::clamp(p, 0.0f, 1.0f) * BakedPath::kIntervals;
+        int i = std::min(static_cast<int>(x), BakedPath::kIntervals - 1);
+        float f = x - static_cast<float>(i);
+
+        float values[kPoseChannelCount];
+        for (int c = 0; c < kPoseChannelCount; ++c)
+        {
+            float a = baked.samples[c][i];
+            values[c] = a + (baked.samples[c][i + 1] - a) * f;
+        }
+
+        out.pos[0] = values[kPosX];
+        out.pos[1] = values[kPosY];
+        out.pos[2] = values[kPosZ];
+        out.rot[0] = values[kYaw];
+        out.rot[1] = values[kPitch];
+        out.fov = values[kFov];
+    }
+
+} // namespace SPF_FrontalBlindspotViewer
@@ -0,0 +1,156 @@
+/**
+ * @file PeekPath.hpp
+ * @brief Pure math for the "live" peek camera path and its baked sample table.
+ *
+ * @details The "live" animation moves the seat along a quadratic Bezier arc, eases yaw with
+ * an in-out cubic and only starts looking up during the last 30% of the movement. The easing of
+ * the seat is applied to the distance travelled along the arc (through an `ArcLengthTable`), not
+ * to the Bezier parameter, so the seat does not speed up and slow down with how far the control
+ * point pulls the arc. None of
+ * that depends on anything but the animation progress once the start and end poses are known,
+ * so the whole path is baked into a fixed-size table when the peek is triggered and each
+ * frame only performs an interpolated table fetch.
+ *
+ * This header is part of the `SPF_FrontalBlindspotViewer_Animation` library, which has no
+ * dependency on the SPF API and builds on every platform.
+ */
+#pragma once
+
+namespace SPF_FrontalBlindspotViewer {
+
+// =================================================================================================
+// 1. Pose Types
+// =================================================================================================
+
+/**
+ * @brief Indices of the individually animated camera channels.
+ */
+enum PoseChannel : int {
+  kPosX = 0,
+  kPosY,
+  kPosZ,
+  kYaw,
+  kPitch,
+  kFov,
+  kPoseChannelCount
+};
+
+/**
+ * @brief A complete interior camera pose: seat position, head rotation and FOV.
+ */
+struct CameraPose {
+  float pos[3] = { 0.0f, 0.0f, 0.0f };
+  float rot[2] = { 0.0f, 0.0f }; // yaw, pitch
+  float fov = 0.0f;
+};
+
+/**
+ * @brief Builds a `CameraPose` from the separate arrays used by the plugin context.
+ */
+CameraPose MakeCameraPose(const float pos[3], const float rot[2], float fov);
+
+/** @brief Reads one channel of a pose by its `PoseChannel` index. */
+float GetPoseChannel(const CameraPose& pose, int channel);
+
+/** @brief Writes one channel of a pose by its `PoseChannel` index. */
+void SetPoseChannel(CameraPose& pose, int channel, float value);
+
+/** @brief Multiplies every channel by `k` (e.g. a velocity from per unit of progress to per second). */
+void ScalePose(CameraPose& pose, float k);
+
+// =================================================================================================
+// 2. Arc Length
+// =================================================================================================
+
+/**
+ * @brief Maps the distance travelled along a curve to the curve parameter that reaches it.
+ *
+ * @details Holds the cumulative chord length at `kSegments + 1` evenly spaced parameter values,
+ * normalized to 0..1. It is built once when a peek is triggered; `ParameterAtDistance` inverts
+ * it with a fixed number of branch-free bisection steps and a linear interpolation within the
+ * segment found. For the peek arcs reachable from the settings sliders the travelled distance
+ * stays within 0.1% of the requested one (`bench/ArcLengthBench.cpp` measures the bound).
+ */
+struct ArcLengthTable {
+  static constexpr int kSegments = 32; // A power of two, for the bisection
+  static constexpr int kSamples = kSegments + 1;
+
+  float distance[kSamples] = {}; // 0 at the start, 1 at the end, non-decreasing
+};
+
+/**
+ * @brief Builds the table from the positions of a curve at `kSamples` evenly spaced parameters.
+ * @details A curve that does not move (all points equal) maps distance to parameter 1:1.
+ */
+void BuildArcLengthTable(const float (&points)[ArcLengthTable::kSamples][3], ArcLengthTable& out);
+
+/**
+ * @brief The curve parameter (0..1) at which the curve has travelled `s` (clamped to 0..1) of its length.
+ */
+float ParameterAtDistance(const ArcLengthTable& table, float s);
+
+// =================================================================================================
+// 3. Analytic "Live" Path
+// =================================================================================================
+
+/**
+ * @brief Everything needed to evaluate the "live" path at an arbitrary progress value.
+ */
+struct LivePath {
+  CameraPose start;
+  CameraPose end;
+  float control[3] = { 0.0f, 0.0f, 0.0f }; // Bezier control point P1 that "pulls" the arc.
+  ArcLengthTable arc;                      // Of the seat arc, built by `MakeLivePath`.
+};
+
+/** @brief The single easing used for the seat arc and the yaw. */
+float EaseInOutCubic(float t);
+
+/** @brief Quadratic Bezier curve formula: B(t) = (1-t)^2*P0 + 2*(1-t)*t*P1 + t^2*P2 */
+float QuadraticBezier(float t, float p0, float p1, float p2);
+
+/**
+ * @brief Prepares a "live" path between two poses, including the arc-length table of its seat arc.
+ * @param towardsTarget `true` when animating from the seat to the peek pose. The horizontal
+ *        position of the control point depends on the direction to make the "lift" feel
+ *        natural when returning to the seat.
+ */
+LivePath MakeLivePath(const CameraPose& start, const CameraPose& end, bool towardsTarget);
+
+/**
+ * @brief Evaluates the "live" path analytically at progress `p` (0..1).
+ * @details This is the reference implementation the baked table is generated from.
+ */
+void EvaluateLivePath(const LivePath& path, float p, CameraPose& out);
+
+// =================================================================================================
+// 4. Baked Path
+// =================================================================================================
+
+/**
+ * @brief A fixed-size, structure-of-arrays sample table of a path.
+ *
+ * @details With 128 intervals the linear reconstruction stays within 3 mm of the analytic
+ * "live" path for position and within 1e-3 rad / 1e-3 degrees for rotation and FOV, even for
+ * the most extreme poses reachable from the settings sliders. Typical peeks of well under a
+ * meter deviate by a fraction of that; `bench/PeekPathBench.cpp` measures the actual bound.
+ */
+struct BakedPath {
+  static constexpr int kIntervals = 128;
+  static constexpr int kSampleCount = kIntervals + 1;
+
+  float samples[kPoseChannelCount][kSampleCount] = {};
+};
+
+/**
+ * @brief Samples `path` at `BakedPath::kSampleCount` evenly spaced progress values.
+ */
+void BakeLivePath(const LivePath& path, BakedPath& out);
+
+/**
+ * @brief Reconstructs the pose at progress `p` (clamped to 0..1) by linear interpolation
+ * between the two neighbouring samples.
+ */
+void SampleBakedPath(const BakedPath& baked, float p, CameraPose& out);
+
+}  // namespace SPF_FrontalBlindspotViewer
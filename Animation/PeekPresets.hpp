@@ -0,0 +1,48 @@
+/**
+ * @file PeekPresets.hpp
+ * @brief The named peek poses (front, left and right A-pillar, kerb) and their built-in defaults.
+ *
+ * @details Each preset has its own keybind. The plugin keeps the poses in one contiguous
+ * `PeekPresetTable` and copies the selected one into its target pose when a preset key is
+ * pressed, so the frame loop reads the same three arrays no matter how many presets there are.
+ *
+ * The front preset is the `target_camera` group (and the per-truck profiles); the others are
+ * stored as `[x, y, z, yaw, pitch, fov]` arrays under `presets.<name>`.
+ */
+#pragma once
+
+#include "PeekPath.hpp" // For CameraPose
+
+namespace SPF_FrontalBlindspotViewer {
+
+enum PeekPreset : int {
+  kPeekPresetFront = 0, // The overhead traffic light; the "toggle" keybind
+  kPeekPresetLeftPillar,
+  kPeekPresetRightPillar,
+  kPeekPresetKerb,
+  kPeekPresetCount
+};
+
+/**
+ * @brief The name of every preset, in enum order: `presets.<name>` and the `peek_<name>` keybind.
+ */
+inline constexpr const char* kPeekPresetNames[kPeekPresetCount] = {"front", "left_pillar", "right_pillar", "kerb"};
+
+/**
+ * @brief One pose per `PeekPreset`.
+ */
+struct PeekPresetTable {
+  CameraPose poses[kPeekPresetCount];
+};
+
+/**
+ * @brief The poses used until the user stores their own (offsets from the seat, as `target_camera`).
+ */
+inline constexpr PeekPresetTable kDefaultPeekPresets = {{
+  {{ -0.06f, -0.10f, -0.88f }, { -0.03f, 0.58f }, 80.0f },  // Front: up at the traffic light
+  {{ -0.30f, 0.00f, -0.55f }, { 0.75f, 0.05f }, 75.0f },    // Left A-pillar: lean left, look around it
+  {{ 0.35f, 0.00f, -0.55f }, { -0.75f, 0.05f }, 75.0f },    // Right A-pillar
+  {{ 0.30f, -0.05f, -0.70f }, { -0.60f, -0.45f }, 80.0f },  // Kerb: down past the passenger door
+}};
+
+}  // namespace SPF_FrontalBlindspotViewer
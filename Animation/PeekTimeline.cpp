@@ -0,0 +1,180 @@
+/**
+ * @file PeekTimeline.cpp
+ * @brief Implementation of the keyframe timelines.
+ */
+
+#include "PeekTimeline.hpp"
+#include <algorithm> // For std::clamp, std::min
+#include <cstddef>   // For size_t
+#include <cstring>   // For std::strcmp
+
+namespace SPF_FrontalBlindspotViewer
+{
+
+    // =================================================================================================
+    // 1. Keys
+    // =================================================================================================
+
+    const char *TimelineEasingName(TimelineEasing easing)
+    {
+        switch (easing)
+        {
+        case TimelineEasing::Linear:
+            return "linear";
+        case TimelineEasing::EaseIn:
+            return "in";
+        case TimelineEasing::EaseOut:
+            return "out";
+        case TimelineEasing::EaseInOut:
+        default:
+            return "in_out";
+        }
+    }
+
+    TimelineEasing ParseTimelineEasing(const char *name, TimelineEasing fallback)
+    {
+        for (uint8_t i = 0; i < static_cast<uint8_t>(TimelineEasing::Count); ++i)
+        {
+            TimelineEasing easing = static_cast<TimelineEasing>(i);
+            if (std::strcmp(name, TimelineEasingName(easing)) == 0)
+            {
+                return easing;
+            }
+        }
+        return fallback;
+    }
+
+    namespace
+    {
+        // u * (e0 + u * (e1 + u * e2)) for every TimelineEasing, in enum order.
+        constexpr float kEaseCoefficients[][3] = {
+            {1.0f, 0.0f, 0.0f},  // Linear
+            {0.0f, 0.0f, 1.0f},  // EaseIn: u^3
+            {3.0f, -3.0f, 1.0f}, // EaseOut: 1 - (1 - u)^3
+            {0.0f, 3.0f, -2.0f}, // EaseInOut: 3u^2 - 2u^3
+        };
+        static_assert(sizeof(kEaseCoefficients) / sizeof(kEaseCoefficients[0]) == static_cast<size_t>(TimelineEasing::Count),
+                      "Every TimelineEasing needs its coefficients");
+
+        // Writes key `index` and the segment that ends at it (the previous key must be written).
+        void WriteKey(PeekTimeline &timeline, int channel, int index, float time, float amount, float offset, TimelineEasing easing)
+        {
+            if (static_cast<uint8_t>(easing) >= static_cast<uint8_t>(TimelineEasing::Count))
+                easing = TimelineEasing::Linear;
+
+            timeline.time[channel][index] = time;
+            timeline.amount[channel][index] = amount;
+            timeline.offset[channel][index] = offset;
+            timeline.easing[channel][index] = easing;
+            timeline.rate[channel][index] = index > 0 ? 1.0f / (time - timeline.time[channel][index - 1]) : 0.0f;
+            for (int i = 0; i < 3; ++i)
+                timeline.ease[channel][index][i] = kEaseCoefficients[static_cast<uint8_t>(easing)][i];
+        }
+    } // namespace
+
+    // =================================================================================================
+    // 2. Timeline
+    // =================================================================================================
+
+    void ResetTimelineChannel(PeekTimeline &timeline, int channel, TimelineEasing easing)
+    {
+        WriteKey(timeline, channel, 0, 0.0f, 0.0f, 0.0f, TimelineEasing::Linear);
+        WriteKey(timeline, channel, 1, 1.0f, 1.0f, 0.0f, easing);
+        timeline.count[channel] = 2;
+    }
+
+    bool SetTimelineChannel(PeekTimeline &timeline, int channel, const TimelineKey *keys, int count)
+    {
+        if (channel < 0 || channel >= kPoseChannelCount || count < 0)
+            return false;
+
+        // A trailing key at t = 1 becomes the implicit last key; everything else is in between.
+        bool has_end = count > 0 && keys[count - 1].time >= 1.0f;
+        int inner = has_end ? count - 1 : count;
+        if (inner > PeekTimeline::kMaxAuthoredKeys)
+            return false;
+
+        float previous = 0.0f;
+        for (int k = 0; k < inner; ++k)
+        {
+            if (!(keys[k].time > previous) || !(keys[k].time < 1.0f)) // Also rejects NaN
+                return false;
+            previous = keys[k].time;
+        }
+
+        ResetTimelineChannel(timeline, channel);
+        for (int k = 0; k < inner; ++k)
+        {
+            WriteKey(timeline, channel, k + 1, keys[k].time, keys[k].amount, keys[k].offset, keys[k].easing);
+        }
+        TimelineEasing last = has_end ? keys[count - 1].easing : TimelineEasing::EaseInOut;
+        WriteKey(timeline, channel, inner + 1, 1.0f, 1.0f, 0.0f, last);
+        timeline.count[channel] = static_cast<uint8_t>(inner + 2);
+        return true;
+    }
+
+    PeekTimeline MakeDefaultPeekTimeline()
+    {
+        using E = TimelineEasing;
+        // Lean towards the windscreen, pause, then look up (a little past the target) and settle.
+        const TimelineKey lean[] = {{0.45f, 0.9f, 0.0f, E::EaseInOut}, {0.6f, 0.9f, 0.0f, E::Linear}, {1.0f, 1.0f, 0.0f, E::EaseInOut}};
+        const TimelineKey lift[] = {{0.45f, 0.5f, 0.12f, E::EaseOut}, {0.6f, 0.6f, 0.12f, E::Linear}, {1.0f, 1.0f, 0.0f, E::EaseInOut}};
+        const TimelineKey turn[] = {{0.45f, 0.8f, 0.0f, E::EaseInOut}, {0.6f, 0.85f, 0.0f, E::Linear}, {1.0f, 1.0f, 0.0f, E::EaseInOut}};
+        const TimelineKey look_up[] = {{0.6f, 0.0f, 0.0f, E::Linear}, {0.9f, 1.08f, 0.0f, E::EaseOut}, {1.0f, 1.0f, 0.0f, E::EaseInOut}};
+
+        PeekTimeline timeline;
+        SetTimelineChannel(timeline, kPosX, lean, 3);
+        SetTimelineChannel(timeline, kPosY, lift, 3);
+        SetTimelineChannel(timeline, kPosZ, lean, 3);
+        SetTimelineChannel(timeline, kYaw, turn, 3);
+        SetTimelineChannel(timeline, kPitch, look_up, 3);
+        ResetTimelineChannel(timeline, kFov, E::Linear);
+        return timeline;
+    }
+
+    // =================================================================================================
+    // 3. Evaluation
+    // =================================================================================================
+
+    void EvaluateTimeline(const PeekTimeline &timeline, const CameraPose &start, const CameraPose &end, float t,
+                          TimelineCursor &cursor, CameraPose &out)
+    {
+        t = std::clamp(t, 0.0f, 1.0f);
+        const float from[kPoseChannelCount] = {start.pos[0], start.pos[1], start.pos[2], start.rot[0], start.rot[1], start.fov};
+        const float to[kPoseChannelCount] = {end.pos[0], end.pos[1], end.pos[2], end.rot[0], end.rot[1], end.fov};
+
+        float values[kPoseChannelCount];
+        for (int c = 0; c < kPoseChannelCount; ++c)
+        {
+            const float *time = timeline.time[c];
+            int last_segment = timeline.count[c] - 2;
+
+            // Walk from the cached segment; usually it still contains t, or the next one does.
+            int k = std::min<int>(cursor.segment[c], last_segment);
+            while (k < last_segment && t >= time[k + 1])
+                ++k;
+            while (k > 0 && t < time[k])
+                --k;
+            cursor.segment[c] = static_cast<uint8_t>(k);
+
+            // Every segment is longer than 0 (see SetTimelineChannel), so `rate` is finite.
+            float x = (t - time[k]) * timeline.rate[c][k + 1];
+            const float *e = timeline.ease[c][k + 1];
+            float u = x * (e[0] + x * (e[1] + x * e[2]));
+            const float *amount = timeline.amount[c] + k;
+            const float *offset = timeline.offset[c] + k;
+            float blend = amount[0] + (amount[1] - amount[0]) * u;
+
+            // Written as a weighted sum, so amount 0 and 1 give the start and end values exactly.
+            values[c] = from[c] * (1.0f - blend) + to[c] * blend + offset[0] + (offset[1] - offset[0]) * u;
+        }
+
+        out.pos[0] = values[kPosX];
+        out.pos[1] = values[kPosY];
+        out.pos[2] = values[kPosZ];
+        out.rot[0] = values[kYaw];
+        out.rot[1] = values[kPitch];
+        out.fov = values[kFov];
+    }
+
+} // namespace SPF_FrontalBlindspotViewer
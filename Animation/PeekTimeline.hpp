@@ -0,0 +1,133 @@
+/**
+ * @file PeekTimeline.hpp
+ * @brief Data-driven peek motions: a sequence of keyframes per camera channel.
+ *
+ * @details A timeline describes the shape of a peek independently of where it starts and ends.
+ * Every channel has its own keyframes; a key sets, at a point in time (0..1 of the animation),
+ * how far the channel has moved from the start pose towards the end pose (`amount`) plus an
+ * absolute `offset` (e.g. lifting the head by 15 cm halfway), and the easing of the segment that
+ * leads up to it. Every channel implicitly starts at amount 0 and ends at amount 1 without an
+ * offset, so the animation always begins and ends exactly on its poses. "Lean, pause, look up,
+ * settle" is then e.g. a lean of the position channels to 0.9 by t = 0.45 that is held until
+ * t = 0.6, while the pitch stays at 0 until t = 0.6 and looks up past the target before settling.
+ *
+ * The keys are stored as a structure of arrays per channel, together with the reciprocal length
+ * and the easing polynomial of the segment leading up to each key, so evaluating a channel takes
+ * no division and no branch on the easing. `TimelineCursor` remembers the segment each channel
+ * was last evaluated in. Progress only moves a little per frame, so the segment is found again
+ * with one comparison and a lookup is O(1) amortized; a jump (e.g. a reversal) walks from the
+ * cached segment.
+ *
+ * This header is part of the `SPF_FrontalBlindspotViewer_Animation` library, which has no
+ * dependency on the SPF API and builds on every platform.
+ */
+#pragma once
+
+#include <cstdint> // For uint8_t
+
+#include "PeekPath.hpp" // For CameraPose and PoseChannel
+
+namespace SPF_FrontalBlindspotViewer {
+
+// =================================================================================================
+// 1. Keys
+// =================================================================================================
+
+/**
+ * @brief The easing of the segment that leads up to a key.
+ */
+enum class TimelineEasing : uint8_t {
+  Linear = 0,
+  EaseIn,    // u^3, slow start
+  EaseOut,   // 1 - (1 - u)^3, slow end
+  EaseInOut, // Smoothstep 3u^2 - 2u^3, slow at both ends
+  Count
+};
+
+/**
+ * @brief Returns the JSON name (`"linear"`, `"in"`, `"out"`, `"in_out"`) of an easing.
+ */
+const char* TimelineEasingName(TimelineEasing easing);
+
+/**
+ * @brief Parses an easing name. Unknown names fall back to `fallback`.
+ */
+TimelineEasing ParseTimelineEasing(const char* name, TimelineEasing fallback);
+
+/**
+ * @brief The JSON name (`"x"`, `"y"`, `"z"`, `"yaw"`, `"pitch"`, `"fov"`) of each `PoseChannel`.
+ */
+inline constexpr const char* kTimelineChannelNames[kPoseChannelCount] = {"x", "y", "z", "yaw", "pitch", "fov"};
+
+/**
+ * @brief One authored keyframe of a channel.
+ */
+struct TimelineKey {
+  float time = 1.0f;   // 0..1 of the animation
+  float amount = 1.0f; // 0 = start pose, 1 = end pose; may overshoot
+  float offset = 0.0f; // Added to the channel, in its own unit (meters, radians, degrees)
+  TimelineEasing easing = TimelineEasing::EaseInOut;
+};
+
+// =================================================================================================
+// 2. Timeline
+// =================================================================================================
+
+/**
+ * @brief The keyframes of every channel, including the implicit first and last key.
+ * @details Fill every channel (`ResetTimelineChannel`, `SetTimelineChannel`) or start from
+ * `MakeDefaultPeekTimeline` before evaluating it.
+ */
+struct PeekTimeline {
+  static constexpr int kMaxKeys = 10;                    // Per channel, the implicit ones included
+  static constexpr int kMaxAuthoredKeys = kMaxKeys - 2;
+
+  float time[kPoseChannelCount][kMaxKeys] = {};
+  float amount[kPoseChannelCount][kMaxKeys] = {};
+  float offset[kPoseChannelCount][kMaxKeys] = {};
+  TimelineEasing easing[kPoseChannelCount][kMaxKeys] = {}; // Of the segment ending at the key
+  float rate[kPoseChannelCount][kMaxKeys] = {};            // 1 / length of that segment
+  float ease[kPoseChannelCount][kMaxKeys][3] = {};         // Its easing as u * (e0 + u * (e1 + u * e2))
+  uint8_t count[kPoseChannelCount] = {};                   // Keys in use, at least 2
+
+  bool operator==(const PeekTimeline&) const = default;
+};
+
+/**
+ * @brief Makes `channel` a single segment from the start to the end pose with `easing`.
+ */
+void ResetTimelineChannel(PeekTimeline& timeline, int channel, TimelineEasing easing = TimelineEasing::EaseInOut);
+
+/**
+ * @brief Replaces the keys of `channel` with `keys` (sorted by strictly increasing time).
+ * @details Keys at t <= 0 are rejected. A key at t = 1 only sets the easing of the final segment;
+ * its amount and offset are forced to 1 and 0, so the channel still ends on the end pose.
+ * @return `false` (and the channel is left unchanged) if there are too many keys or their times
+ * are out of order or out of range.
+ */
+bool SetTimelineChannel(PeekTimeline& timeline, int channel, const TimelineKey* keys, int count);
+
+/**
+ * @brief The built-in "lean, pause, look up, settle" peek.
+ */
+PeekTimeline MakeDefaultPeekTimeline();
+
+// =================================================================================================
+// 3. Evaluation
+// =================================================================================================
+
+/**
+ * @brief The segment each channel was last evaluated in. Reset it when the timeline changes.
+ */
+struct TimelineCursor {
+  uint8_t segment[kPoseChannelCount] = {};
+};
+
+/**
+ * @brief Evaluates the timeline at `t` (clamped to 0..1) between `start` and `end`.
+ * @details Moves `cursor` to the segments that contain `t`.
+ */
+void EvaluateTimeline(const PeekTimeline& timeline, const CameraPose& start, const CameraPose& end, float t,
+                      TimelineCursor& cursor, CameraPose& out);
+
+}  // namespace SPF_FrontalBlindspotViewer
@@ -0,0 +1,123 @@
+/**
+ * @file TruckProfiles.cpp
+ * @brief Implementation of the per-truck peek pose table.
+ */
+
+#include "TruckProfiles.hpp"
+
+#include <cstdio>  // For snprintf
+#include <cstring> // For memcpy
+
+namespace SPF_FrontalBlindspotViewer
+{
+
+    namespace
+    {
+        constexpr uint64_t kFnvOffsetBasis = 14695981039346656037ull;
+        constexpr uint64_t kFnvPrime = 1099511628211ull;
+
+        uint64_t HashString(uint64_t hash, const char *text)
+        {
+            for (; *text; ++text)
+            {
+                hash ^= static_cast<unsigned char>(*text);
+                hash *= kFnvPrime;
+            }
+            return hash;
+        }
+    } // namespace
+
+    uint64_t HashTruckIdentity(const char *brand_id, const char *id)
+    {
+        uint64_t hash = HashString(kFnvOffsetBasis, brand_id);
+
+        // Separator, so "ab" + "c" and "a" + "bc" hash differently.
+        hash ^= '/';
+        hash *= kFnvPrime;
+
+        hash = HashString(hash, id);
+        return hash != 0 ? hash : 1;
+    }
+
+    int FindTruckProfile(const TruckProfileTable &table, uint64_t key)
+    {
+        constexpr int kMask = TruckProfileTable::kCapacity - 1;
+        for (int probe = 0; probe < TruckProfileTable::kCapacity; ++probe)
+        {
+            int index = static_cast<int>((key + probe) & kMask);
+            uint64_t slot_key = table.slots[index].key;
+            if (slot_key == key)
+                return index;
+            if (slot_key == 0)
+                return -1;
+        }
+        return -1;
+    }
+
+    int InsertTruckProfile(TruckProfileTable &table, uint64_t key)
+    {
+        constexpr int kMask = TruckProfileTable::kCapacity - 1;
+        for (int probe = 0; probe < TruckProfileTable::kCapacity; ++probe)
+        {
+            int index = static_cast<int>((key + probe) & kMask);
+            TruckProfileTable::Slot &slot = table.slots[index];
+            if (slot.key == key)
+                return index;
+            if (slot.key == 0)
+            {
+                if (table.count >= TruckProfileTable::kMaxCount)
+                    return -1;
+                slot.key = key;
+                ++table.count;
+                return index;
+            }
+        }
+        return -1;
+    }
+
+    void PublishTruckIdentity(TruckIdentityExchange &exchange, const char *brand_id, const char *id)
+    {
+        TruckIdentity identity;
+        if (brand_id[0])
+        {
+            identity.key = HashTruckIdentity(brand_id, id);
+            snprintf(identity.name, sizeof(identity.name), "%s/%s", brand_id, id);
+        }
+
+        uint64_t words[TruckIdentityExchange::kNameWords];
+        memcpy(words, identity.name, sizeof(words));
+
+        uint32_t sequence = exchange.sequence.load(std::memory_order_relaxed);
+        exchange.sequence.store(sequence + 1, std::memory_order_relaxed); // Odd: write in progress
+        std::atomic_thread_fence(std::memory_order_release);
+
+        exchange.key.store(identity.key, std::memory_order_relaxed);
+        for (int w = 0; w < TruckIdentityExchange::kNameWords; ++w)
+            exchange.name[w].store(words[w], std::memory_order_relaxed);
+
+        exchange.sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    bool ReadTruckIdentity(const TruckIdentityExchange &exchange, uint32_t &seen, TruckIdentity &out)
+    {
+        uint32_t before = exchange.sequence.load(std::memory_order_acquire);
+        if (before == seen || (before & 1) != 0)
+            return false;
+
+        uint64_t key = exchange.key.load(std::memory_order_relaxed);
+        uint64_t words[TruckIdentityExchange::kNameWords];
+        for (int w = 0; w < TruckIdentityExchange::kNameWords; ++w)
+            words[w] = exchange.name[w].load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (exchange.sequence.load(std::memory_order_relaxed) != before)
+            return false; // Torn by a concurrent write; the next frame gets a clean one.
+
+        out.key = key;
+        memcpy(out.name, words, sizeof(words));
+        out.name[TruckIdentity::kNameSize - 1] = '\0';
+        seen = before;
+        return true;
+    }
+
+} // namespace SPF_FrontalBlindspotViewer
@@ -0,0 +1,90 @@
+/**
+ * @file TruckProfiles.hpp
+ * @brief A compact open-addressing table of per-truck peek poses.
+ *
+ * @details Trucks are identified by a 64-bit FNV-1a hash of their telemetry `brand_id` and `id`.
+ * The table is a fixed power-of-two array of `{key, pose}` slots with linear probing, so switching
+ * trucks costs one hash and (almost always) one probe, with no allocation and no JSON access.
+ * Key 0 marks an empty slot; `HashTruckIdentity` never returns it.
+ *
+ * The truck constants arrive on the telemetry thread, which hands the identity to the frame loop
+ * through a `TruckIdentityExchange` (a seqlock of atomics, like `CabinMotionExchange`); the frame
+ * loop does the lookup.
+ */
+#pragma once
+
+#include <atomic>  // For std::atomic
+#include <cstdint> // For uint64_t
+
+#include "PeekPath.hpp" // For CameraPose
+
+namespace SPF_FrontalBlindspotViewer {
+
+/**
+ * @brief Hashes a truck identity (`brand_id` + `id` from the truck constants).
+ */
+uint64_t HashTruckIdentity(const char* brand_id, const char* id);
+
+/**
+ * @brief The stored peek poses, keyed by `HashTruckIdentity`.
+ */
+struct TruckProfileTable {
+  static constexpr int kCapacity = 256;   // Must be a power of two.
+  static constexpr int kMaxCount = 192;   // Keeps the load factor at or below 75%.
+
+  struct Slot {
+    uint64_t key = 0; // 0 = empty
+    CameraPose pose;
+  };
+
+  Slot slots[kCapacity];
+  int count = 0;
+};
+
+/**
+ * @brief Returns the slot index holding `key`, or -1 if the truck has no profile.
+ */
+int FindTruckProfile(const TruckProfileTable& table, uint64_t key);
+
+/**
+ * @brief Returns the slot index for `key`, claiming an empty slot if needed.
+ * @return The slot index, or -1 if the table is full.
+ */
+int InsertTruckProfile(TruckProfileTable& table, uint64_t key);
+
+/**
+ * @brief A truck as named by the truck constants.
+ */
+struct TruckIdentity {
+  static constexpr int kNameSize = 128; // "brand_id/id", truncated to fit
+
+  uint64_t key = 0; // HashTruckIdentity, 0 if no truck
+  char name[kNameSize] = {};
+};
+
+/**
+ * @brief Hands the latest `TruckIdentity` from the telemetry callback to the frame loop.
+ * @details One writer, one reader. The writer never waits; a reader that races with a write
+ * picks the identity up on the next frame.
+ */
+struct TruckIdentityExchange {
+  static constexpr int kNameWords = TruckIdentity::kNameSize / 8;
+
+  std::atomic<uint32_t> sequence{0}; // Odd while a write is in progress, 0 before the first
+  std::atomic<uint64_t> key{0};
+  std::atomic<uint64_t> name[kNameWords] = {};
+};
+
+/**
+ * @brief Writer side: publishes the truck `brand_id`/`id` (an empty `brand_id` means no truck).
+ */
+void PublishTruckIdentity(TruckIdentityExchange& exchange, const char* brand_id, const char* id);
+
+/**
+ * @brief Reader side: copies the identity into `out` if one was published since `seen`.
+ * @return `false` if nothing new was published or a write was in progress (`out` and `seen`
+ * are unchanged).
+ */
+bool ReadTruckIdentity(const TruckIdentityExchange& exchange, uint32_t& seen, TruckIdentity& out);
+
+}  // namespace SPF_FrontalBlindspotViewer
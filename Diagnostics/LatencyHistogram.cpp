@@ -0,0 +1,98 @@
+/**
+ * @file LatencyHistogram.cpp
+ * @brief Implementation of the latency histogram buckets and summaries.
+ */
+
+#include "LatencyHistogram.hpp"
+
+#include <bit> // For std::bit_width
+
+namespace SPF_FrontalBlindspotViewer
+{
+
+    namespace
+    {
+        constexpr int kSubBuckets = 1 << LatencyHistogram::kSubBucketBits;
+
+        double BucketMidpoint(int bucket)
+        {
+            uint64_t lower = LatencyBucketLowerBound(bucket);
+            uint64_t upper = bucket + 1 < LatencyHistogram::kBucketCount ? LatencyBucketLowerBound(bucket + 1) : lower + 1;
+            return 0.5 * static_cast<double>(lower + upper - 1);
+        }
+    } // namespace
+
+    int LatencyBucket(uint64_t ns)
+    {
+        if (ns < 2 * kSubBuckets)
+            return static_cast<int>(ns); // Exact
+
+        int shift = std::bit_width(ns) - 1 - LatencyHistogram::kSubBucketBits;
+        int bucket = (shift + 1) * kSubBuckets + static_cast<int>((ns >> shift) & (kSubBuckets - 1));
+        return bucket < LatencyHistogram::kBucketCount ? bucket : LatencyHistogram::kBucketCount - 1;
+    }
+
+    uint64_t LatencyBucketLowerBound(int bucket)
+    {
+        if (bucket < 2 * kSubBuckets)
+            return static_cast<uint64_t>(bucket);
+
+        int shift = bucket / kSubBuckets - 1;
+        return static_cast<uint64_t>(kSubBuckets + bucket % kSubBuckets) << shift;
+    }
+
+    LatencySummary SummarizeLatency(const LatencyHistogram &histogram)
+    {
+        // Copy first: the writer may keep recording while we walk the buckets.
+        uint32_t counts[LatencyHistogram::kBucketCount];
+        uint64_t total = 0;
+        for (int i = 0; i < LatencyHistogram::kBucketCount; ++i)
+        {
+            counts[i] = histogram.buckets[i].load(std::memory_order_relaxed);
+            total += counts[i];
+        }
+
+        LatencySummary summary;
+        summary.count = total;
+        summary.max_ns = static_cast<double>(histogram.max_ns.load(std::memory_order_relaxed));
+        if (total == 0)
+            return summary;
+
+        // Ranks of the 50th and 99th percentile, 1-based.
+        uint64_t p50_rank = (total + 1) / 2;
+        uint64_t p99_rank = total - total / 100;
+        uint64_t seen = 0;
+        bool have_p50 = false;
+        for (int i = 0; i < LatencyHistogram::kBucketCount; ++i)
+        {
+            seen += counts[i];
+            if (!have_p50 && seen >= p50_rank)
+            {
+                summary.p50_ns = BucketMidpoint(i);
+                have_p50 = true;
+            }
+            if (seen >= p99_rank)
+            {
+                summary.p99_ns = BucketMidpoint(i);
+                break;
+            }
+        }
+
+        // Midpoints can overshoot the largest value actually seen.
+        if (summary.max_ns > 0.0)
+        {
+            summary.p50_ns = summary.p50_ns < summary.max_ns ? summary.p50_ns : summary.max_ns;
+            summary.p99_ns = summary.p99_ns < summary.max_ns ? summary.p99_ns : summary.max_ns;
+        }
+        return summary;
+    }
+
+    void ResetLatency(LatencyHistogram &histogram)
+    {
+        for (auto &bucket : histogram.buckets)
+            bucket.store(0, std::memory_order_relaxed);
+        histogram.count.store(0, std::memory_order_relaxed);
+        histogram.max_ns.store(0, std::memory_order_relaxed);
+    }
+
+} // namespace SPF_FrontalBlindspotViewer
@@ -0,0 +1,111 @@
+/**
+ * @file LatencyHistogram.hpp
+ * @brief Fixed-bucket latency histograms and a scoped timer for the plugin's entry points.
+ *
+ * @details Buckets are log-linear: exact below 16 ns, then eight buckets per power of two, so
+ * every bucket is at most 12.5% wide and 224 buckets reach past one second. Recording is a
+ * bucket index computation and two relaxed counter updates; there is no allocation and no lock.
+ * Each histogram has a single writer thread; any other thread (e.g. the debug window) may read
+ * it at any time and sees slightly stale but never torn counters.
+ *
+ * The timers are only compiled into the plugin with `SPF_FBV_PROFILING` (see
+ * `SPF_FBV_PROFILE_SCOPE`); without it the macro expands to nothing.
+ */
+#pragma once
+
+#include <atomic>  // For std::atomic
+#include <chrono>  // For std::chrono::steady_clock
+#include <cstdint> // For uint32_t, uint64_t
+
+namespace SPF_FrontalBlindspotViewer {
+
+// =================================================================================================
+// 1. Histogram
+// =================================================================================================
+
+/**
+ * @brief Call counts per latency bucket (nanoseconds), plus the exact maximum.
+ */
+struct LatencyHistogram {
+  static constexpr int kSubBucketBits = 3; // 8 buckets per power of two
+  static constexpr int kBucketCount = 224; // Up to ~1.07 s; longer calls land in the last bucket
+
+  std::atomic<uint32_t> buckets[kBucketCount] = {};
+  std::atomic<uint64_t> count{0};
+  std::atomic<uint64_t> max_ns{0};
+};
+
+/**
+ * @brief Summary of a histogram. Percentiles are the midpoints of their buckets.
+ */
+struct LatencySummary {
+  uint64_t count = 0;
+  double p50_ns = 0.0;
+  double p99_ns = 0.0;
+  double max_ns = 0.0;
+};
+
+/**
+ * @brief The bucket `ns` falls into.
+ */
+int LatencyBucket(uint64_t ns);
+
+/**
+ * @brief The smallest latency that falls into `bucket`.
+ */
+uint64_t LatencyBucketLowerBound(int bucket);
+
+/**
+ * @brief Records one call. Must only be called from the histogram's writer thread.
+ */
+inline void RecordLatency(LatencyHistogram& histogram, uint64_t ns) {
+  // Single writer: a plain load and store per counter, no locked read-modify-write.
+  std::atomic<uint32_t>& bucket = histogram.buckets[LatencyBucket(ns)];
+  bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  histogram.count.store(histogram.count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  if (ns > histogram.max_ns.load(std::memory_order_relaxed))
+    histogram.max_ns.store(ns, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Computes count, p50, p99 and max. Safe to call from any thread.
+ */
+LatencySummary SummarizeLatency(const LatencyHistogram& histogram);
+
+/**
+ * @brief Clears the histogram. Only from the writer thread, or while it is not recording.
+ */
+void ResetLatency(LatencyHistogram& histogram);
+
+// =================================================================================================
+// 2. Scoped Timer
+// =================================================================================================
+
+/**
+ * @brief Records the lifetime of the enclosing scope into a histogram.
+ */
+class ScopedLatencyTimer {
+ public:
+  explicit ScopedLatencyTimer(LatencyHistogram& histogram)
+      : histogram_(histogram), start_(std::chrono::steady_clock::now()) {}
+
+  ~ScopedLatencyTimer() {
+    auto elapsed = std::chrono::steady_clock::now() - start_;
+    RecordLatency(histogram_, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+  }
+
+  ScopedLatencyTimer(const ScopedLatencyTimer&) = delete;
+  ScopedLatencyTimer& operator=(const ScopedLatencyTimer&) = delete;
+
+ private:
+  LatencyHistogram& histogram_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+#if defined(SPF_FBV_PROFILING) && SPF_FBV_PROFILING
+#define SPF_FBV_PROFILE_SCOPE(histogram) ::SPF_FrontalBlindspotViewer::ScopedLatencyTimer spf_fbv_profile_scope_(histogram)
+#else
+#define SPF_FBV_PROFILE_SCOPE(histogram) ((void)0)
+#endif
+
+}  // namespace SPF_FrontalBlindspotViewer
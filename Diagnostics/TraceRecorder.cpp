@@ -0,0 +1,259 @@
+/**
+ * @file TraceRecorder.cpp
+ * @brief Implementation of the trace ring and its background writer.
+ */
+
+#include "TraceRecorder.hpp"
+
+#include <chrono> // For std::chrono::milliseconds
+#include <cmath>  // For std::signbit, std::floor, std::fma, std::fmod
+
+namespace SPF_FrontalBlindspotViewer
+{
+
+    namespace
+    {
+        constexpr int kBatchSize = 256;
+        constexpr uint32_t kMask = TraceRing::kCapacity - 1;
+        constexpr auto kDrainInterval = std::chrono::milliseconds(50);
+
+        // --- Text ---------------------------------------------------------------------------------
+
+        char *Append(char *out, const char *text)
+        {
+            while (*text)
+                *out++ = *text++;
+            return out;
+        }
+
+        char *AppendUnsigned(char *out, uint64_t value)
+        {
+            char digits[20];
+            int count = 0;
+            do
+            {
+                digits[count++] = static_cast<char>('0' + value % 10);
+                value /= 10;
+            } while (value != 0);
+            while (count > 0)
+                *out++ = digits[--count];
+            return out;
+        }
+
+        // Same text as "%.<decimals>f" (ties to even on the exact value) for the magnitudes a trace
+        // holds: microsecond timestamps and poses.
+        char *AppendFixed(char *out, double value, int decimals)
+        {
+            static constexpr uint64_t kScale[] = {1, 10, 100, 1000, 10000, 100000};
+            if (!(value == value))
+                value = 0.0; // NaN is not valid JSON
+            if (std::signbit(value))
+            {
+                *out++ = '-';
+                value = -value;
+            }
+
+            uint64_t scale = kScale[decimals];
+            double scaled = value * static_cast<double>(scale);
+            if (scaled > 4e15)
+                scaled = 4e15; // Keeps the fraction below exact; 46 days in microseconds
+            double whole = std::floor(scaled);
+            double rest = scaled - whole;
+            if (rest == 0.5)
+            {
+                // The product may have rounded onto the tie; its exact error says which side it was.
+                double error = std::fma(value, static_cast<double>(scale), -scaled);
+                if (error > 0.0 || (error == 0.0 && std::fmod(whole, 2.0) != 0.0))
+                    whole += 1.0;
+            }
+            else if (rest > 0.5)
+            {
+                whole += 1.0;
+            }
+            uint64_t scaled_int = static_cast<uint64_t>(whole);
+
+            out = AppendUnsigned(out, scaled_int / scale);
+            if (decimals > 0)
+            {
+                *out++ = '.';
+                uint64_t fraction = scaled_int % scale;
+                for (uint64_t digit = scale / 10; digit > 0; digit /= 10)
+                {
+                    *out++ = static_cast<char>('0' + fraction / digit);
+                    fraction %= digit;
+                }
+            }
+            return out;
+        }
+
+        // --- Writer thread ------------------------------------------------------------------------
+
+        void DrainRing(TraceWriter &writer, TraceRing &ring)
+        {
+            static thread_local TraceFrame batch[kBatchSize];
+            char text[kTraceFrameTextSize];
+
+            int count;
+            while ((count = PopTraceFrames(ring, batch, kBatchSize)) > 0)
+            {
+                for (int i = 0; i < count; ++i)
+                {
+                    int length = FormatTraceFrame(batch[i], text, sizeof(text));
+                    if (length == 0)
+                        continue;
+                    if (writer.wrote_event)
+                        std::fputs(",\n", writer.file);
+                    std::fwrite(text, 1, static_cast<size_t>(length), writer.file);
+                    writer.wrote_event = true;
+                }
+                writer.frames_written += static_cast<uint64_t>(count);
+            }
+            std::fflush(writer.file);
+        }
+
+        void WriterLoop(TraceWriter *writer, TraceRing *ring)
+        {
+            std::unique_lock<std::mutex> lock(writer->mutex);
+            while (!writer->stopping)
+            {
+                lock.unlock();
+                DrainRing(*writer, *ring);
+                lock.lock();
+                writer->wake.wait_for(lock, kDrainInterval, [writer] { return writer->stopping; });
+            }
+            lock.unlock();
+
+            // The rest of the recording and the end of the document, still on this thread.
+            DrainRing(*writer, *ring);
+            std::fputs("\n]}\n", writer->file);
+            std::fclose(writer->file);
+            writer->file = nullptr;
+        }
+    } // namespace
+
+    int FormatTraceFrame(const TraceFrame &frame, char *buffer, int size)
+    {
+        if (size < kTraceFrameTextSize)
+            return 0;
+
+        // Trace timestamps are microseconds. The frame slice ends at the frame's timestamp.
+        double end_us = frame.time * 1e6;
+        double duration_us = frame.frame_time * 1e6;
+        const char *name = frame.kind == kTraceHold ? "hold" : ((frame.flags & kTraceTowardsTarget) ? "peek" : "return");
+        const CameraPose &p = frame.pose;
+
+        // The counters all share the frame's end timestamp.
+        char ts[32];
+        char *ts_end = AppendFixed(ts, end_us, 3);
+        *ts_end = '\0';
+
+        char *out = buffer;
+        out = Append(out, "{\"name\":\"");
+        out = Append(out, name);
+        out = Append(out, "\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":");
+        out = AppendFixed(out, end_us - duration_us, 3);
+        out = Append(out, ",\"dur\":");
+        out = AppendFixed(out, duration_us, 3);
+        out = Append(out, ",\"args\":{\"session\":");
+        out = AppendUnsigned(out, frame.session);
+        out = Append(out, ",\"progress\":");
+        out = AppendFixed(out, frame.progress, 5);
+        out = Append(out, (frame.flags & kTraceHitch) ? ",\"hitch\":true}},\n" : ",\"hitch\":false}},\n");
+
+        out = Append(out, "{\"name\":\"progress\",\"ph\":\"C\",\"pid\":1,\"ts\":");
+        out = Append(out, ts);
+        out = Append(out, ",\"args\":{\"progress\":");
+        out = AppendFixed(out, frame.progress, 5);
+        out = Append(out, "}},\n{\"name\":\"frame time (ms)\",\"ph\":\"C\",\"pid\":1,\"ts\":");
+        out = Append(out, ts);
+        out = Append(out, ",\"args\":{\"dt\":");
+        out = AppendFixed(out, frame.frame_time * 1000.0, 3);
+        out = Append(out, "}},\n{\"name\":\"position\",\"ph\":\"C\",\"pid\":1,\"ts\":");
+        out = Append(out, ts);
+        out = Append(out, ",\"args\":{\"x\":");
+        out = AppendFixed(out, p.pos[0], 5);
+        out = Append(out, ",\"y\":");
+        out = AppendFixed(out, p.pos[1], 5);
+        out = Append(out, ",\"z\":");
+        out = AppendFixed(out, p.pos[2], 5);
+        out = Append(out, "}},\n{\"name\":\"rotation\",\"ph\":\"C\",\"pid\":1,\"ts\":");
+        out = Append(out, ts);
+        out = Append(out, ",\"args\":{\"yaw\":");
+        out = AppendFixed(out, p.rot[0], 5);
+        out = Append(out, ",\"pitch\":");
+        out = AppendFixed(out, p.rot[1], 5);
+        out = Append(out, "}},\n{\"name\":\"fov\",\"ph\":\"C\",\"pid\":1,\"ts\":");
+        out = Append(out, ts);
+        out = Append(out, ",\"args\":{\"fov\":");
+        out = AppendFixed(out, p.fov, 3);
+        out = Append(out, "}},\n{\"name\":\"camera calls\",\"ph\":\"C\",\"pid\":1,\"ts\":");
+        out = Append(out, ts);
+        out = Append(out, ",\"args\":{\"made\":");
+        out = AppendUnsigned(out, frame.calls_made);
+        out = Append(out, ",\"skipped\":");
+        out = AppendUnsigned(out, frame.calls_skipped);
+        out = Append(out, "}}");
+        return static_cast<int>(out - buffer);
+    }
+
+    bool PushTraceFrame(TraceRing &ring, const TraceFrame &frame)
+    {
+        uint32_t head = ring.head.load(std::memory_order_relaxed);
+        if (head - ring.tail.load(std::memory_order_acquire) >= TraceRing::kCapacity)
+        {
+            ring.dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        ring.frames[head & kMask] = frame;
+        ring.head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    int PopTraceFrames(TraceRing &ring, TraceFrame *out, int max_count)
+    {
+        uint32_t tail = ring.tail.load(std::memory_order_relaxed);
+        uint32_t available = ring.head.load(std::memory_order_acquire) - tail;
+        int count = available < static_cast<uint32_t>(max_count) ? static_cast<int>(available) : max_count;
+
+        for (int i = 0; i < count; ++i)
+            out[i] = ring.frames[(tail + static_cast<uint32_t>(i)) & kMask];
+        ring.tail.store(tail + static_cast<uint32_t>(count), std::memory_order_release);
+        return count;
+    }
+
+    bool StartTraceWriter(TraceWriter &writer, TraceRing &ring, const char *path)
+    {
+        writer.file = std::fopen(path, "wb");
+        if (!writer.file)
+            return false;
+
+        // Leftovers from an earlier recording do not belong in this file.
+        TraceFrame stale[kBatchSize];
+        while (PopTraceFrames(ring, stale, kBatchSize) > 0)
+        {
+        }
+
+        std::fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", writer.file);
+        writer.frames_written = 0;
+        writer.wrote_event = false;
+        writer.stopping = false;
+        writer.running.store(true, std::memory_order_release);
+        writer.thread = std::thread(WriterLoop, &writer, &ring);
+        return true;
+    }
+
+    void StopTraceWriter(TraceWriter &writer)
+    {
+        if (!writer.running.exchange(false, std::memory_order_acq_rel))
+            return;
+
+        {
+            std::lock_guard<std::mutex> lock(writer.mutex);
+            writer.stopping = true;
+        }
+        writer.wake.notify_one(); // Instead of waiting out the drain interval
+        writer.thread.join();
+    }
+
+} // namespace SPF_FrontalBlindspotViewer
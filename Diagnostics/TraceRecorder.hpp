@@ -0,0 +1,126 @@
+/**
+ * @file TraceRecorder.hpp
+ * @brief Opt-in per-frame recording of peek animations, exported as a Chrome trace.
+ *
+ * @details The frame loop pushes one fixed-size `TraceFrame` per animated frame into a
+ * single-producer/single-consumer ring that is allocated once with the plugin. Pushing copies the
+ * record and publishes it with a release store; when the ring is full the frame is dropped and
+ * counted, so the render thread never allocates, locks or waits.
+ *
+ * A `TraceWriter` owns a background thread that drains the ring and appends the frames to a
+ * `chrome://tracing` / Perfetto JSON file: each frame becomes a slice as long as its frame time,
+ * plus counter tracks for the progress, the pose and the camera calls made and skipped. All of the
+ * text is made on that thread, including the rest of the recording and the end of the document
+ * when it is stopped; stopping wakes it instead of waiting for its next drain.
+ */
+#pragma once
+
+#include <atomic>             // For std::atomic
+#include <condition_variable> // For std::condition_variable
+#include <cstdint>            // For uint8_t, uint16_t, uint32_t, uint64_t
+#include <cstdio>             // For FILE
+#include <mutex>              // For std::mutex
+#include <thread>             // For std::thread
+
+#include "PeekPath.hpp" // For CameraPose
+
+namespace SPF_FrontalBlindspotViewer {
+
+// =================================================================================================
+// 1. Records
+// =================================================================================================
+
+enum TraceFrameKind : uint8_t {
+  kTraceAnimation = 0, // A toggle peek animation; `progress` runs along the segment
+  kTraceHold           // The "hold to peek" input; `progress` is the filtered input amount
+};
+
+enum TraceFrameFlags : uint8_t {
+  kTraceHitch = 1 << 0,        // The frame time exceeded the hitch threshold
+  kTraceTowardsTarget = 1 << 1 // Moving towards the peek pose (not back to the seat)
+};
+
+/**
+ * @brief Everything recorded about one frame.
+ */
+struct TraceFrame {
+  double time = 0.0;        // Frame timestamp, seconds
+  float frame_time = 0.0f;  // Seconds since the previous frame
+  float progress = 0.0f;
+  CameraPose pose;          // The pose handed to the camera writer
+  uint16_t calls_made = 0;  // Cam_Set* calls made this frame
+  uint16_t calls_skipped = 0;
+  uint8_t kind = kTraceAnimation;
+  uint8_t flags = 0;
+  uint32_t session = 0;     // Increments with every peek started
+};
+
+inline constexpr int kTraceFrameTextSize = 1024; // Enough for the text of any one frame
+
+/**
+ * @brief Formats one frame as comma-separated Chrome trace events (no trailing comma, not
+ * NUL-terminated).
+ * @return The length written, or 0 if `size` is less than `kTraceFrameTextSize`.
+ */
+int FormatTraceFrame(const TraceFrame& frame, char* buffer, int size);
+
+// =================================================================================================
+// 2. Ring
+// =================================================================================================
+
+/**
+ * @brief A fixed single-producer/single-consumer queue of `TraceFrame`s.
+ */
+struct TraceRing {
+  static constexpr uint32_t kCapacity = 4096; // Power of two; over a minute at 60 Hz
+
+  TraceFrame frames[kCapacity];
+  std::atomic<uint32_t> head{0};    // Next slot to write; owned by the producer
+  std::atomic<uint32_t> tail{0};    // Next slot to read; owned by the consumer
+  std::atomic<uint64_t> dropped{0}; // Frames lost to a full ring
+};
+
+/**
+ * @brief Producer side: queues a copy of `frame`.
+ * @return `false` if the ring is full (the frame is dropped and counted).
+ */
+bool PushTraceFrame(TraceRing& ring, const TraceFrame& frame);
+
+/**
+ * @brief Consumer side: moves up to `max_count` frames into `out`.
+ * @return The number of frames taken.
+ */
+int PopTraceFrames(TraceRing& ring, TraceFrame* out, int max_count);
+
+// =================================================================================================
+// 3. Writer
+// =================================================================================================
+
+/**
+ * @brief The background thread that writes a ring to a trace file.
+ */
+struct TraceWriter {
+  std::thread thread;
+  std::atomic<bool> running{false};
+  std::mutex mutex;
+  std::condition_variable wake;
+  bool stopping = false;       // Guarded by `mutex`
+  FILE* file = nullptr;        // Owned by the writer thread while it runs
+  uint64_t frames_written = 0; // Owned by the writer thread while it runs
+  bool wrote_event = false;
+};
+
+/**
+ * @brief Opens `path` and starts draining `ring` into it.
+ * @details Frames left in the ring from an earlier recording are discarded first. Must not be
+ * called while the writer is running.
+ * @return `false` if the file could not be created.
+ */
+bool StartTraceWriter(TraceWriter& writer, TraceRing& ring, const char* path);
+
+/**
+ * @brief Has the thread write what is left in the ring and close the file, and joins it.
+ */
+void StopTraceWriter(TraceWriter& writer);
+
+}  // namespace SPF_FrontalBlindspotViewer
@@ -0,0 +1,740 @@
+/**
+ * @file HeadlessFramework.cpp
+ * @brief Implementation of the headless framework stand-in.
+ */
+
+#include "HeadlessFramework.hpp"
+#include "CameraBinding.hpp" // For kInteriorCameraFinder
+
+#include <algorithm> // For std::min
+#include <chrono>    // For std::chrono::milliseconds, std::chrono::steady_clock
+#include <cstdarg>   // For va_list
+#include <cstdio>    // For std::vsnprintf, std::printf
+#include <cstdlib>   // For std::strtod
+#include <cstring>   // For std::strlen, std::strcmp, std::strncmp, std::strcspn, std::memcpy
+#include <memory>    // For std::make_unique
+#include <thread>    // For std::this_thread::sleep_for
+
+namespace SPF_FrontalBlindspotViewer::Headless
+{
+
+    namespace
+    {
+        HeadlessFramework *g_active = nullptr;
+
+        // The handles are opaque to the plugin; any distinct non-null address will do.
+        char g_handle_storage[6];
+        template <typename Handle>
+        Handle *FakeHandle(int index)
+        {
+            return reinterpret_cast<Handle *>(&g_handle_storage[index]);
+        }
+
+        // A no-op for every manifest builder call the stand-in does not care about.
+        template <typename... Args>
+        void Ignore(Args...)
+        {
+        }
+
+        // --- Config tree ---------------------------------------------------------------------------
+
+        // Parses the JSON the plugin hands over (the manifest defaults, Cfg_SetJsonString).
+        struct JsonParser
+        {
+            const char *cursor;
+
+            void SkipSpace()
+            {
+                while (*cursor == ' ' || *cursor == '\n' || *cursor == '\r' || *cursor == '\t')
+                    ++cursor;
+            }
+
+            std::string ParseString()
+            {
+                std::string text;
+                ++cursor; // Opening quote
+                while (*cursor && *cursor != '"')
+                {
+                    if (*cursor == '\\' && cursor[1])
+                        ++cursor;
+                    text += *cursor++;
+                }
+                if (*cursor)
+                    ++cursor;
+                return text;
+            }
+
+            void ParseValue(HeadlessJson &value)
+            {
+                value = HeadlessJson();
+                SkipSpace();
+                if (*cursor == '{' || *cursor == '[')
+                {
+                    bool object = *cursor == '{';
+                    char close = object ? '}' : ']';
+                    value.type = object ? SPF_JSON_TYPE_OBJECT : SPF_JSON_TYPE_ARRAY;
+                    ++cursor;
+                    for (SkipSpace(); *cursor && *cursor != close; SkipSpace())
+                    {
+                        auto item = std::make_unique<HeadlessJson>();
+                        if (object)
+                        {
+                            std::string key = ParseString();
+                            SkipSpace();
+                            ++cursor; // ':'
+                            ParseValue(*item);
+                            value.members.emplace_back(std::move(key), std::move(item));
+                        }
+                        else
+                        {
+                            ParseValue(*item);
+                            value.items.push_back(std::move(item));
+                        }
+                        SkipSpace();
+                        if (*cursor == ',')
+                            ++cursor;
+                    }
+                    if (*cursor)
+                        ++cursor;
+                }
+                else if (*cursor == '"')
+                {
+                    value.type = SPF_JSON_TYPE_STRING;
+                    value.text = ParseString();
+                }
+                else if (std::strncmp(cursor, "true", 4) == 0 || std::strncmp(cursor, "false", 5) == 0)
+                {
+                    value.type = SPF_JSON_TYPE_BOOLEAN;
+                    value.number = *cursor == 't' ? 1.0 : 0.0;
+                    cursor += *cursor == 't' ? 4 : 5;
+                }
+                else if (std::strncmp(cursor, "null", 4) == 0)
+                {
+                    cursor += 4;
+                }
+                else
+                {
+                    char *end = nullptr;
+                    value.number = std::strtod(cursor, &end);
+                    bool integer = end > cursor && std::strcspn(cursor, ".eE,}] \n") >= static_cast<size_t>(end - cursor);
+                    value.type = integer ? SPF_JSON_TYPE_NUMBER_INTEGER : SPF_JSON_TYPE_NUMBER_FLOAT;
+                    cursor = end > cursor ? end : cursor + 1;
+                }
+            }
+        };
+
+        HeadlessJson *FindMember(const HeadlessJson &object, const char *name, size_t length)
+        {
+            for (const auto &member : object.members)
+            {
+                if (member.first.size() == length && std::strncmp(member.first.c_str(), name, length) == 0)
+                    return member.second.get();
+            }
+            return nullptr;
+        }
+
+        // Splits the dotted path and walks it from the root on every call, like the framework.
+        HeadlessJson *FindPath(HeadlessFramework &framework, const char *path, bool create)
+        {
+            HeadlessJson *node = &framework.config_root;
+            while (node && *path)
+            {
+                size_t length = std::strcspn(path, ".");
+                HeadlessJson *child = node->type == SPF_JSON_TYPE_OBJECT ? FindMember(*node, path, length) : nullptr;
+                if (!child && create)
+                {
+                    if (node->type != SPF_JSON_TYPE_OBJECT)
+                    {
+                        *node = HeadlessJson{};
+                        node->type = SPF_JSON_TYPE_OBJECT;
+                    }
+                    node->members.emplace_back(std::string(path, length), std::make_unique<HeadlessJson>());
+                    child = node->members.back().second.get();
+                }
+                node = child;
+                path += length;
+                if (*path == '.')
+                    ++path;
+            }
+            return node;
+        }
+
+        // FindPath for the config reads, charged per segment of the path.
+        const HeadlessJson *ReadConfigPath(const char *key)
+        {
+            ++g_active->config_reads;
+            uint64_t segments = 1;
+            for (const char *c = key; *c; ++c)
+                segments += *c == '.';
+            g_active->config_path_segments += segments;
+
+            if (g_active->config_segment_ns > 0)
+            {
+                auto until = std::chrono::steady_clock::now() + std::chrono::nanoseconds(g_active->config_segment_ns * segments);
+                while (std::chrono::steady_clock::now() < until)
+                {
+                }
+            }
+            return FindPath(*g_active, key, false);
+        }
+
+        bool IsNumber(const HeadlessJson &value)
+        {
+            return value.type == SPF_JSON_TYPE_NUMBER_INTEGER || value.type == SPF_JSON_TYPE_NUMBER_UNSIGNED ||
+                   value.type == SPF_JSON_TYPE_NUMBER_FLOAT || value.type == SPF_JSON_TYPE_BOOLEAN;
+        }
+
+        void ManifestSettingsJson(SPF_Manifest_Builder_Handle *, const char *json)
+        {
+            JsonParser parser{json};
+            parser.ParseValue(*FindPath(*g_active, "settings", true));
+        }
+
+        // --- Logger / formatting ------------------------------------------------------------------
+
+        SPF_Logger_Handle *LogGetContext(const char *) { return FakeHandle<SPF_Logger_Handle>(0); }
+
+        void Log(SPF_Logger_Handle *, SPF_LogLevel level, const char *message)
+        {
+            ++g_active->log_messages;
+            if (g_active->echo_log)
+                std::printf("[log %d] %s\n", static_cast<int>(level), message);
+        }
+
+        void LogThrottled(SPF_Logger_Handle *h, SPF_LogLevel level, const char *, uint32_t, const char *message)
+        {
+            Log(h, level, message);
+        }
+
+        int Format(char *buffer, size_t buffer_size, const char *format, ...)
+        {
+            va_list args;
+            va_start(args, format);
+            int written = std::vsnprintf(buffer, buffer_size, format, args);
+            va_end(args);
+            return written;
+        }
+
+        // --- Config -------------------------------------------------------------------------------
+
+        SPF_Config_Handle *CfgGetContext(const char *) { return FakeHandle<SPF_Config_Handle>(1); }
+
+        double CfgGetFloat(SPF_Config_Handle *, const char *key, double defaultValue)
+        {
+            const HeadlessJson *value = ReadConfigPath(key);
+            return value && IsNumber(*value) ? value->number : defaultValue;
+        }
+
+        int CfgGetString(SPF_Config_Handle *, const char *key, const char *defaultValue, char *out_buffer, int buffer_size)
+        {
+            const HeadlessJson *value = ReadConfigPath(key);
+            const char *text = value && value->type == SPF_JSON_TYPE_STRING ? value->text.c_str() : defaultValue;
+            return std::snprintf(out_buffer, static_cast<size_t>(buffer_size), "%s", text ? text : "");
+        }
+
+        bool CfgGetBool(SPF_Config_Handle *h, const char *key, bool defaultValue)
+        {
+            return CfgGetFloat(h, key, defaultValue ? 1.0 : 0.0) != 0.0;
+        }
+
+        SPF_JsonValue_Handle *CfgGetJsonValueHandle(SPF_Config_Handle *, const char *key)
+        {
+            return reinterpret_cast<SPF_JsonValue_Handle *>(const_cast<HeadlessJson *>(ReadConfigPath(key)));
+        }
+
+        void CfgSetJsonString(SPF_Config_Handle *, const char *key, const char *json_literal)
+        {
+            ++g_active->config_writes;
+            if (std::this_thread::get_id() != g_active->frame_thread)
+                ++g_active->foreign_config_writes;
+            JsonParser parser{json_literal};
+            parser.ParseValue(*FindPath(*g_active, key, true));
+        }
+
+        void CfgSave(SPF_Config_Handle *)
+        {
+            if (g_active->config_save_ms > 0)
+                std::this_thread::sleep_for(std::chrono::milliseconds(g_active->config_save_ms));
+            ++g_active->config_saves;
+        }
+
+        // --- JSON reader --------------------------------------------------------------------------
+
+        const HeadlessJson *AsJson(const SPF_JsonValue_Handle *h)
+        {
+            ++g_active->json_reads;
+            return reinterpret_cast<const HeadlessJson *>(h);
+        }
+
+        SPF_JsonValue_Handle *AsHandle(const HeadlessJson *value)
+        {
+            return reinterpret_cast<SPF_JsonValue_Handle *>(const_cast<HeadlessJson *>(value));
+        }
+
+        SPF_JsonType JsonGetType(const SPF_JsonValue_Handle *h)
+        {
+            const HeadlessJson *value = AsJson(h);
+            return value ? value->type : SPF_JSON_TYPE_NULL;
+        }
+
+        double JsonGetFloat(const SPF_JsonValue_Handle *h, double default_value)
+        {
+            const HeadlessJson *value = AsJson(h);
+            return value && IsNumber(*value) ? value->number : default_value;
+        }
+
+        bool JsonGetBool(const SPF_JsonValue_Handle *h, bool default_value)
+        {
+            return JsonGetFloat(h, default_value ? 1.0 : 0.0) != 0.0;
+        }
+
+        int64_t JsonGetInt(const SPF_JsonValue_Handle *h, int64_t default_value)
+        {
+            return static_cast<int64_t>(JsonGetFloat(h, static_cast<double>(default_value)));
+        }
+
+        int32_t JsonGetInt32(const SPF_JsonValue_Handle *h, int32_t default_value)
+        {
+            return static_cast<int32_t>(JsonGetFloat(h, default_value));
+        }
+
+        uint64_t JsonGetUint(const SPF_JsonValue_Handle *h, uint64_t default_value)
+        {
+            return static_cast<uint64_t>(JsonGetFloat(h, static_cast<double>(default_value)));
+        }
+
+        int JsonGetString(const SPF_JsonValue_Handle *h, char *out_buffer, int buffer_size)
+        {
+            const HeadlessJson *value = AsJson(h);
+            const char *text = value && value->type == SPF_JSON_TYPE_STRING ? value->text.c_str() : "";
+            return std::snprintf(out_buffer, static_cast<size_t>(buffer_size), "%s", text);
+        }
+
+        SPF_JsonValue_Handle *JsonGetMember(const SPF_JsonValue_Handle *h, const char *memberName)
+        {
+            const HeadlessJson *value = AsJson(h);
+            return value && value->type == SPF_JSON_TYPE_OBJECT ? AsHandle(FindMember(*value, memberName, std::strlen(memberName))) : nullptr;
+        }
+
+        bool JsonHasMember(const SPF_JsonValue_Handle *h, const char *memberName)
+        {
+            return JsonGetMember(h, memberName) != nullptr;
+        }
+
+        int JsonGetArraySize(const SPF_JsonValue_Handle *h)
+        {
+            const HeadlessJson *value = AsJson(h);
+            return value ? static_cast<int>(value->items.size()) : 0;
+        }
+
+        SPF_JsonValue_Handle *JsonGetArrayItem(const SPF_JsonValue_Handle *h, int index)
+        {
+            const HeadlessJson *value = AsJson(h);
+            return value && index >= 0 && index < static_cast<int>(value->items.size()) ? AsHandle(value->items[index].get()) : nullptr;
+        }
+
+        int JsonGetObjectSize(const SPF_JsonValue_Handle *h)
+        {
+            const HeadlessJson *value = AsJson(h);
+            return value ? static_cast<int>(value->members.size()) : 0;
+        }
+
+        int JsonGetMemberName(const SPF_JsonValue_Handle *h, int index, char *out_buffer, int buffer_size)
+        {
+            const HeadlessJson *value = AsJson(h);
+            if (!value || index < 0 || index >= static_cast<int>(value->members.size()) || buffer_size <= 0)
+                return 0;
+
+            // Returns the full length like snprintf, so a result >= buffer_size means truncated.
+            const std::string &name = value->members[index].first;
+            size_t copied = std::min(name.size(), static_cast<size_t>(buffer_size) - 1);
+            std::memcpy(out_buffer, name.data(), copied);
+            out_buffer[copied] = '\0';
+            return static_cast<int>(name.size());
+        }
+
+        SPF_JsonValue_Handle *JsonGetMemberValueByIndex(const SPF_JsonValue_Handle *h, int index)
+        {
+            const HeadlessJson *value = AsJson(h);
+            return value && index >= 0 && index < static_cast<int>(value->members.size()) ? AsHandle(value->members[index].second.get()) : nullptr;
+        }
+
+        // --- Localization -------------------------------------------------------------------------
+
+        SPF_Localization_Handle *LocGetContext(const char *) { return FakeHandle<SPF_Localization_Handle>(2); }
+
+        // --- Keybinds -----------------------------------------------------------------------------
+
+        SPF_KeyBinds_Handle *KbindGetContext(const char *) { return FakeHandle<SPF_KeyBinds_Handle>(3); }
+
+        void KbindRegister(SPF_KeyBinds_Handle *, const char *actionName, void (*callback)(void))
+        {
+            g_active->keybind_callbacks[actionName] = callback;
+        }
+
+        void KbindRegisterEx(SPF_KeyBinds_Handle *, const char *actionName, SPF_Keybind_Callback_Ex callback, void *user_data)
+        {
+            g_active->keybind_callbacks_ex[actionName] = {callback, user_data};
+        }
+
+        float KbindGetActionValue(SPF_KeyBinds_Handle *, const char *actionName)
+        {
+            ++g_active->action_value_queries;
+            auto it = g_active->action_values.find(actionName);
+            return it != g_active->action_values.end() ? it->second : 0.0f;
+        }
+
+        // --- Camera -------------------------------------------------------------------------------
+
+        void RecordCameraCall(CameraCallKind kind, float a, float b = 0.0f, float c = 0.0f)
+        {
+            bool is_set = kind <= CameraCallKind::SetFov;
+            ++(is_set ? g_active->camera_sets : g_active->camera_gets);
+            if (g_active->record_camera_calls)
+                g_active->camera_calls.push_back(CameraCall{kind, g_active->now, {a, b, c}});
+        }
+
+        bool CamGetInteriorSeatPos(float *x, float *y, float *z)
+        {
+            *x = g_active->seat_pos[0];
+            *y = g_active->seat_pos[1];
+            *z = g_active->seat_pos[2];
+            RecordCameraCall(CameraCallKind::GetSeatPos, *x, *y, *z);
+            return true;
+        }
+
+        void CamSetInteriorSeatPos(float x, float y, float z)
+        {
+            g_active->seat_pos[0] = x;
+            g_active->seat_pos[1] = y;
+            g_active->seat_pos[2] = z;
+            RecordCameraCall(CameraCallKind::SetSeatPos, x, y, z);
+        }
+
+        bool CamGetInteriorHeadRot(float *yaw, float *pitch)
+        {
+            *yaw = g_active->head_rot[0];
+            *pitch = g_active->head_rot[1];
+            RecordCameraCall(CameraCallKind::GetHeadRot, *yaw, *pitch);
+            return true;
+        }
+
+        void CamSetInteriorHeadRot(float yaw, float pitch)
+        {
+            g_active->head_rot[0] = yaw;
+            g_active->head_rot[1] = pitch;
+            RecordCameraCall(CameraCallKind::SetHeadRot, yaw, pitch);
+        }
+
+        bool CamGetInteriorFov(float *fov)
+        {
+            *fov = g_active->fov;
+            RecordCameraCall(CameraCallKind::GetFov, *fov);
+            return true;
+        }
+
+        void CamSetInteriorFov(float fov)
+        {
+            g_active->fov = fov;
+            RecordCameraCall(CameraCallKind::SetFov, fov);
+        }
+
+        bool CamGetCurrentCamera(SPF_CameraType *out_cameraType)
+        {
+            ++g_active->current_camera_queries;
+            *out_cameraType = g_active->current_camera;
+            return true;
+        }
+
+        bool CamIsServiceReady()
+        {
+            ++g_active->camera_status_queries;
+            return g_active->camera_service_ready;
+        }
+
+        bool CamAreAllOffsetsFound()
+        {
+            ++g_active->camera_status_queries;
+            return g_active->camera_service_ready && g_active->interior_camera_found;
+        }
+
+        bool CamIsFinderReady(const char *finderName)
+        {
+            ++g_active->camera_status_queries;
+            return g_active->camera_service_ready && g_active->interior_camera_found && std::strcmp(finderName, kInteriorCameraFinder) == 0;
+        }
+
+        bool CamRefreshOffsets()
+        {
+            ++g_active->offset_refreshes;
+            g_active->interior_camera_found |= g_active->refresh_finds_interior;
+            return g_active->interior_camera_found;
+        }
+
+        // --- Telemetry ----------------------------------------------------------------------------
+
+        SPF_Telemetry_Handle *TelGetContext(const char *) { return FakeHandle<SPF_Telemetry_Handle>(4); }
+
+        SPF_Telemetry_Callback_Handle *TelRegisterForTruckConstants(SPF_Telemetry_Handle *, SPF_Telemetry_TruckConstants_Callback callback, void *user_data)
+        {
+            g_active->truck_constants_callback = callback;
+            g_active->truck_constants_user_data = user_data;
+            return nullptr;
+        }
+
+        SPF_Telemetry_Callback_Handle *TelRegisterForTruckData(SPF_Telemetry_Handle *, SPF_Telemetry_TruckData_Callback callback, void *user_data)
+        {
+            g_active->truck_data_callback = callback;
+            g_active->truck_data_user_data = user_data;
+            return nullptr;
+        }
+
+        SPF_Telemetry_Callback_Handle *TelRegisterForGameState(SPF_Telemetry_Handle *, SPF_Telemetry_GameState_Callback callback, void *user_data)
+        {
+            g_active->game_state_callback = callback;
+            g_active->game_state_user_data = user_data;
+            return nullptr;
+        }
+
+        // --- Environment --------------------------------------------------------------------------
+
+        SPF_Environment_Handle *EnvGetContext(const char *) { return FakeHandle<SPF_Environment_Handle>(5); }
+
+        int EnvGetPluginLogsDir(SPF_Environment_Handle *, char *out_buffer, int buffer_size)
+        {
+            return std::snprintf(out_buffer, static_cast<size_t>(buffer_size), "%s", g_active->logs_dir.c_str());
+        }
+
+        bool EnvCreatePath(SPF_Environment_Handle *, const char *) { return true; }
+
+        void BuildApiTables(HeadlessFramework &framework)
+        {
+            SPF_Manifest_Builder_API &m = framework.manifest_api;
+            m.Info_SetName = Ignore;
+            m.Info_SetVersion = Ignore;
+            m.Info_SetMinFrameworkVersion = Ignore;
+            m.Info_SetAuthor = Ignore;
+            m.Info_SetDescriptionKey = Ignore;
+            m.Info_SetDescriptionLiteral = Ignore;
+            m.Info_SetEmail = Ignore;
+            m.Info_SetDiscordUrl = Ignore;
+            m.Info_SetSteamProfileUrl = Ignore;
+            m.Info_SetGithubUrl = Ignore;
+            m.Info_SetYoutubeUrl = Ignore;
+            m.Info_SetScsForumUrl = Ignore;
+            m.Info_SetPatreonUrl = Ignore;
+            m.Info_SetWebsiteUrl = Ignore;
+            m.Policy_SetAllowUserConfig = Ignore;
+            m.Policy_AddConfigurableSystem = Ignore;
+            m.Policy_AddRequiredHook = Ignore;
+            m.Settings_SetJson = ManifestSettingsJson;
+            m.Defaults_SetLogging = Ignore;
+            m.Defaults_SetLocalization = Ignore;
+            m.Defaults_AddKeybind = Ignore;
+            m.Defaults_AddWindow = Ignore;
+            m.Meta_AddCustomSetting = Ignore;
+            m.Meta_AddKeybind = Ignore;
+            m.Meta_AddWindow = Ignore;
+            m.Meta_AddStandardSetting = Ignore;
+
+            framework.logger.Log_GetContext = LogGetContext;
+            framework.logger.Log = Log;
+            framework.logger.LogThrottled = LogThrottled;
+            framework.formatting.Fmt_Format = Format;
+
+            framework.config.Cfg_GetContext = CfgGetContext;
+            framework.config.Cfg_GetFloat = CfgGetFloat;
+            framework.config.Cfg_GetString = CfgGetString;
+            framework.config.Cfg_GetBool = CfgGetBool;
+            framework.config.Cfg_GetJsonValueHandle = CfgGetJsonValueHandle;
+            framework.config.Cfg_SetJsonString = CfgSetJsonString;
+            framework.config.Cfg_Save = CfgSave;
+
+            framework.json_reader.Json_GetType = JsonGetType;
+            framework.json_reader.Json_GetBool = JsonGetBool;
+            framework.json_reader.Json_GetInt = JsonGetInt;
+            framework.json_reader.Json_GetInt32 = JsonGetInt32;
+            framework.json_reader.Json_GetUint = JsonGetUint;
+            framework.json_reader.Json_GetFloat = JsonGetFloat;
+            framework.json_reader.Json_GetString = JsonGetString;
+            framework.json_reader.Json_HasMember = JsonHasMember;
+            framework.json_reader.Json_GetMember = JsonGetMember;
+            framework.json_reader.Json_GetArraySize = JsonGetArraySize;
+            framework.json_reader.Json_GetArrayItem = JsonGetArrayItem;
+            framework.json_reader.Json_GetObjectSize = JsonGetObjectSize;
+            framework.json_reader.Json_GetMemberName = JsonGetMemberName;
+            framework.json_reader.Json_GetMemberValueByIndex = JsonGetMemberValueByIndex;
+
+            framework.localization.Loc_GetContext = LocGetContext;
+
+            framework.keybinds.Kbind_GetContext = KbindGetContext;
+            framework.keybinds.Kbind_Register = KbindRegister;
+            framework.keybinds.Kbind_Register_Ex = KbindRegisterEx;
+            framework.keybinds.Kbind_GetActionValue = KbindGetActionValue;
+
+            framework.camera.Cam_GetInteriorSeatPos = CamGetInteriorSeatPos;
+            framework.camera.Cam_SetInteriorSeatPos = CamSetInteriorSeatPos;
+            framework.camera.Cam_GetInteriorHeadRot = CamGetInteriorHeadRot;
+            framework.camera.Cam_SetInteriorHeadRot = CamSetInteriorHeadRot;
+            framework.camera.Cam_GetInteriorFov = CamGetInteriorFov;
+            framework.camera.Cam_SetInteriorFov = CamSetInteriorFov;
+            framework.camera.Cam_GetCurrentCamera = CamGetCurrentCamera;
+            framework.camera.Cam_IsServiceReady = CamIsServiceReady;
+            framework.camera.Cam_AreAllOffsetsFound = CamAreAllOffsetsFound;
+            framework.camera.Cam_IsFinderReady = CamIsFinderReady;
+            framework.camera.Cam_RefreshOffsets = CamRefreshOffsets;
+
+            framework.telemetry.Tel_GetContext = TelGetContext;
+            framework.telemetry.Tel_RegisterForTruckConstants = TelRegisterForTruckConstants;
+            framework.telemetry.Tel_RegisterForTruckData = TelRegisterForTruckData;
+            framework.telemetry.Tel_RegisterForGameState = TelRegisterForGameState;
+
+            framework.environment.Env_GetContext = EnvGetContext;
+            framework.environment.Env_GetPluginLogsDir = EnvGetPluginLogsDir;
+            framework.environment.Env_CreatePath = EnvCreatePath;
+
+            framework.load_api.logger = &framework.logger;
+            framework.load_api.localization = &framework.localization;
+            framework.load_api.config = &framework.config;
+            framework.load_api.formatting = &framework.formatting;
+            framework.load_api.environment = &framework.environment;
+
+            framework.core_api.logger = &framework.logger;
+            framework.core_api.localization = &framework.localization;
+            framework.core_api.config = &framework.config;
+            framework.core_api.keybinds = &framework.keybinds;
+            framework.core_api.telemetry = &framework.telemetry;
+            framework.core_api.camera = &framework.camera;
+            framework.core_api.formatting = &framework.formatting;
+            framework.core_api.environment = &framework.environment;
+            framework.core_api.json_reader = &framework.json_reader;
+        }
+    } // namespace
+
+    void StartHeadlessFramework(HeadlessFramework &framework, const SPF_Manifest_API &manifest, const SPF_Plugin_Exports &exports)
+    {
+        g_active = &framework;
+        framework.frame_thread = std::this_thread::get_id();
+        framework.manifest = manifest;
+        framework.exports = exports;
+        BuildApiTables(framework);
+
+        // Same order as the framework: manifest (seeds the config defaults), load, activate.
+        if (manifest.BuildManifest)
+            manifest.BuildManifest(FakeHandle<SPF_Manifest_Builder_Handle>(0), &framework.manifest_api);
+        if (exports.OnLoad)
+            exports.OnLoad(&framework.load_api);
+        if (exports.OnActivated)
+            exports.OnActivated(&framework.core_api);
+    }
+
+    void StopHeadlessFramework(HeadlessFramework &framework)
+    {
+        if (framework.exports.OnUnload)
+            framework.exports.OnUnload();
+        if (g_active == &framework)
+            g_active = nullptr;
+    }
+
+    void RunHeadlessFrames(HeadlessFramework &framework, int frames, double frame_time)
+    {
+        for (int frame = 0; frame < frames; ++frame)
+        {
+            framework.now += frame_time;
+            if (framework.exports.OnUpdate)
+                framework.exports.OnUpdate();
+        }
+    }
+
+    bool PressHeadlessKeybind(HeadlessFramework &framework, const char *action)
+    {
+        auto ex = framework.keybind_callbacks_ex.find(action);
+        if (ex != framework.keybind_callbacks_ex.end() && ex->second.callback)
+        {
+            ex->second.callback(action, ex->second.user_data);
+            return true;
+        }
+
+        auto it = framework.keybind_callbacks.find(action);
+        if (it == framework.keybind_callbacks.end() || !it->second)
+            return false;
+        it->second();
+        return true;
+    }
+
+    void ChangeHeadlessSetting(HeadlessFramework &framework, const char *path, double value)
+    {
+        // A checkbox stays a boolean; everything else becomes a number.
+        HeadlessJson *node = FindPath(framework, path, true);
+        if (node->type != SPF_JSON_TYPE_BOOLEAN)
+            node->type = SPF_JSON_TYPE_NUMBER_FLOAT;
+        node->number = node->type == SPF_JSON_TYPE_BOOLEAN ? (value != 0.0 ? 1.0 : 0.0) : value;
+        if (framework.exports.OnSettingChanged)
+            framework.exports.OnSettingChanged(FakeHandle<SPF_Config_Handle>(1), path);
+    }
+
+    void ChangeHeadlessSetting(HeadlessFramework &framework, const char *path, const char *value)
+    {
+        HeadlessJson *node = FindPath(framework, path, true);
+        *node = HeadlessJson{};
+        node->type = SPF_JSON_TYPE_STRING;
+        node->text = value;
+        if (framework.exports.OnSettingChanged)
+            framework.exports.OnSettingChanged(FakeHandle<SPF_Config_Handle>(1), path);
+    }
+
+    void SetHeadlessJson(HeadlessFramework &framework, const char *path, const char *json)
+    {
+        JsonParser parser{json};
+        parser.ParseValue(*FindPath(framework, path, true));
+    }
+
+    void SendHeadlessTruck(HeadlessFramework &framework, const char *brand_id, const char *id)
+    {
+        if (!framework.truck_constants_callback)
+            return;
+
+        SPF_TruckConstants constants{};
+        std::snprintf(constants.brand_id, sizeof(constants.brand_id), "%s", brand_id);
+        std::snprintf(constants.id, sizeof(constants.id), "%s", id);
+        framework.truck_constants_callback(&constants, framework.truck_constants_user_data);
+    }
+
+    void SendHeadlessTruckData(HeadlessFramework &framework)
+    {
+        if (framework.truck_data_callback)
+            framework.truck_data_callback(&framework.truck_data, framework.truck_data_user_data);
+    }
+
+    void SendHeadlessTruckData(HeadlessFramework &framework, float speed, float brake, float throttle, bool parking_brake)
+    {
+        framework.truck_data.speed = speed;
+        framework.truck_data.input_brake = brake;
+        framework.truck_data.input_throttle = throttle;
+        framework.truck_data.parking_brake = parking_brake;
+        SendHeadlessTruckData(framework);
+    }
+
+    void SendHeadlessGameState(HeadlessFramework &framework, bool paused, float scale)
+    {
+        if (!framework.game_state_callback)
+            return;
+
+        SPF_GameState state{};
+        state.paused = paused;
+        state.scale = scale;
+        framework.game_state_callback(&state, framework.game_state_user_data);
+    }
+
+    void SendHeadlessGameWorldReady(HeadlessFramework &framework)
+    {
+        if (framework.exports.OnGameWorldReady)
+            framework.exports.OnGameWorldReady();
+    }
+
+    double HeadlessNow()
+    {
+        return g_active ? g_active->now : 0.0;
+    }
+
+} // namespace SPF_FrontalBlindspotViewer::Headless
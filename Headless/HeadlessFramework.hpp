@@ -0,0 +1,236 @@
+/**
+ * @file HeadlessFramework.hpp
+ * @brief A stand-in for the SPF framework that runs the plugin without the game.
+ *
+ * @details Provides just enough of `SPF_Load_API`/`SPF_Core_API` for the plugin: a camera that
+ * records every `Cam_Set*`/`Cam_Get*` call, can be switched away from the interior view and can
+ * report its service as not ready (or the interior camera as not found), a
+ * config tree seeded from the manifest's default settings JSON (read through the config API,
+ * path by path, or walked with a `SPF_JsonReader_API`; saving can be made slow), keybinds that can be pressed or
+ * held from a script, truck-constants, truck data and game state (pause) events, a logs directory, a counting logger and a simulated clock. Scenarios call the
+ * plugin's exports exactly like the framework does (`BuildManifest`, `OnLoad`, `OnActivated`,
+ * `OnUpdate`, `OnSettingChanged`, ...).
+ *
+ * Only one `HeadlessFramework` can be active at a time, since the SPF API tables are plain C
+ * function pointers without a user pointer. This code is for benchmarks and Linux builds only
+ * and is never part of the plugin DLL.
+ */
+#pragma once
+
+#include <cstddef> // For size_t, which SPF_Hooks_API.h uses without including it itself.
+
+#include <SPF_Plugin.h>
+#include <SPF_Manifest_API.h>
+#include <SPF_Logger_API.h>
+#include <SPF_Formatting_API.h>
+#include <SPF_Config_API.h>
+#include <SPF_JsonReader_API.h>
+#include <SPF_Localization_API.h>
+#include <SPF_KeyBinds_API.h>
+#include <SPF_Camera_API.h>
+#include <SPF_Telemetry_API.h>
+#include <SPF_Environment_API.h>
+
+#include <atomic>        // For std::atomic
+#include <cstdint>       // For uint64_t
+#include <memory>        // For std::unique_ptr
+#include <string>        // For std::string
+#include <thread>        // For std::thread::id
+#include <unordered_map> // For std::unordered_map
+#include <utility>       // For std::pair
+#include <vector>        // For std::vector
+
+namespace SPF_FrontalBlindspotViewer::Headless {
+
+// =================================================================================================
+// 1. Recorded Camera Calls
+// =================================================================================================
+
+enum class CameraCallKind : uint8_t {
+  SetSeatPos,
+  SetHeadRot,
+  SetFov,
+  GetSeatPos,
+  GetHeadRot,
+  GetFov
+};
+
+/**
+ * @brief One call made to the fake `SPF_Camera_API`, with the values written or returned.
+ */
+struct CameraCall {
+  CameraCallKind kind;
+  double time;      // Simulated clock at the time of the call
+  float values[3];  // pos xyz, yaw/pitch or fov; unused entries are 0
+};
+
+// =================================================================================================
+// 2. Config Tree
+// =================================================================================================
+
+/**
+ * @brief One value of the config; handed to the plugin as an `SPF_JsonValue_Handle`.
+ * @details Object members keep their order and are found by a linear search, like the
+ * framework's ordered JSON.
+ */
+struct HeadlessJson {
+  SPF_JsonType type = SPF_JSON_TYPE_NULL;
+  double number = 0.0; // Numbers; booleans as 0 or 1
+  std::string text;    // Strings
+  std::vector<std::pair<std::string, std::unique_ptr<HeadlessJson>>> members; // Objects
+  std::vector<std::unique_ptr<HeadlessJson>> items;                           // Arrays
+};
+
+// =================================================================================================
+// 3. Framework
+// =================================================================================================
+
+/**
+ * @brief The whole fake framework: API tables, the state behind them and the plugin's exports.
+ */
+struct HeadlessFramework {
+  // --- API tables handed to the plugin ---
+  SPF_Manifest_Builder_API manifest_api{};
+  SPF_Logger_API logger{};
+  SPF_Formatting_API formatting{};
+  SPF_Config_API config{};
+  SPF_JsonReader_API json_reader{};
+  SPF_Localization_API localization{};
+  SPF_KeyBinds_API keybinds{};
+  SPF_Camera_API camera{};
+  SPF_Telemetry_API telemetry{};
+  SPF_Environment_API environment{};
+  SPF_Load_API load_api{};
+  SPF_Core_API core_api{};
+
+  // --- The plugin ---
+  SPF_Manifest_API manifest{};
+  SPF_Plugin_Exports exports{};
+  std::thread::id frame_thread; // The thread that started the framework and runs its frames
+
+  // --- Simulated clock (seconds) ---
+  double now = 0.0;
+
+  // --- Camera ---
+  float seat_pos[3] = { 0.0f, 0.0f, 0.0f };
+  float head_rot[2] = { 0.0f, 0.0f };
+  float fov = 65.0f;
+  SPF_CameraType current_camera = SPF_CAMERA_INTERIOR; // Cam_GetCurrentCamera
+  uint64_t current_camera_queries = 0;
+  bool camera_service_ready = true;     // Cam_IsServiceReady
+  bool interior_camera_found = true;    // Cam_IsFinderReady(kInteriorCameraFinder)
+  bool refresh_finds_interior = false;  // Cam_RefreshOffsets sets interior_camera_found
+  uint64_t camera_status_queries = 0;   // Cam_IsServiceReady, Cam_AreAllOffsetsFound, Cam_IsFinderReady
+  uint64_t offset_refreshes = 0;        // Cam_RefreshOffsets
+  bool record_camera_calls = true; // Off for benchmarks that only want the counters
+  std::vector<CameraCall> camera_calls;
+  uint64_t camera_sets = 0;
+  uint64_t camera_gets = 0;
+
+  // --- Config: { "settings": { ... } }, addressed by "settings.group.key" paths ---
+  HeadlessJson config_root;
+  uint64_t config_reads = 0;
+  uint64_t json_reads = 0; // SPF_JsonReader_API calls
+  uint64_t config_path_segments = 0; // Path segments split off and looked up by the config reads
+  int config_segment_ns = 0; // Extra busy time per segment, like the framework's split and member lookup
+  std::atomic<uint64_t> config_writes{0};
+  std::atomic<uint64_t> foreign_config_writes{0}; // Made off the frame thread (the one that started the framework)
+  std::atomic<uint64_t> config_saves{0};          // Made from the plugin's config saver thread
+  int config_save_ms = 0; // How long Cfg_Save takes, like writing the file to a slow disk
+
+  // --- Keybinds ---
+  struct KeybindCallbackEx {
+    SPF_Keybind_Callback_Ex callback = nullptr;
+    void* user_data = nullptr;
+  };
+  std::unordered_map<std::string, void (*)()> keybind_callbacks;
+  std::unordered_map<std::string, KeybindCallbackEx> keybind_callbacks_ex; // Kbind_Register_Ex
+  std::unordered_map<std::string, float> action_values; // Kbind_GetActionValue, 0 if absent
+  uint64_t action_value_queries = 0;
+
+  // --- Telemetry ---
+  SPF_Telemetry_TruckConstants_Callback truck_constants_callback = nullptr;
+  void* truck_constants_user_data = nullptr;
+  SPF_Telemetry_TruckData_Callback truck_data_callback = nullptr;
+  void* truck_data_user_data = nullptr;
+  SPF_TruckData truck_data{}; // Sent by SendHeadlessTruckData; scenarios may edit any field
+  SPF_Telemetry_GameState_Callback game_state_callback = nullptr;
+  void* game_state_user_data = nullptr;
+
+  // --- Environment ---
+  std::string logs_dir = "."; // Env_GetPluginLogsDir
+
+  // --- Logger ---
+  uint64_t log_messages = 0;
+  bool echo_log = false; // Print every message to stdout
+};
+
+/**
+ * @brief Runs the manifest, `OnLoad` and `OnActivated`, making `framework` the active instance.
+ * @param manifest As returned by the plugin's `SPF_GetManifestAPI`.
+ * @param exports As returned by the plugin's `SPF_GetPlugin`.
+ */
+void StartHeadlessFramework(HeadlessFramework& framework, const SPF_Manifest_API& manifest,
+                            const SPF_Plugin_Exports& exports);
+
+/**
+ * @brief Calls `OnUnload` and deactivates the framework.
+ */
+void StopHeadlessFramework(HeadlessFramework& framework);
+
+/**
+ * @brief Advances the simulated clock by `frame_time` and calls `OnUpdate`, `frames` times.
+ */
+void RunHeadlessFrames(HeadlessFramework& framework, int frames, double frame_time);
+
+/**
+ * @brief Invokes the callback registered for `action` (the full "Plugin.action" name).
+ * @return `false` if the plugin registered no callback for it.
+ */
+bool PressHeadlessKeybind(HeadlessFramework& framework, const char* action);
+
+/**
+ * @brief Writes a setting into the config and notifies the plugin, like the settings UI.
+ * @param path The full path, e.g. "settings.animation.speed".
+ */
+void ChangeHeadlessSetting(HeadlessFramework& framework, const char* path, double value);
+void ChangeHeadlessSetting(HeadlessFramework& framework, const char* path, const char* value);
+
+/**
+ * @brief Replaces the value at `path` with the parsed `json`, without notifying the plugin (like
+ * editing settings.json before the game starts).
+ */
+void SetHeadlessJson(HeadlessFramework& framework, const char* path, const char* json);
+
+/**
+ * @brief Sends a truck-constants event for the given truck.
+ */
+void SendHeadlessTruck(HeadlessFramework& framework, const char* brand_id, const char* id);
+
+/**
+ * @brief Sends `framework.truck_data` as one truck data update, like a telemetry frame.
+ */
+void SendHeadlessTruckData(HeadlessFramework& framework);
+
+/**
+ * @brief Sets the speed (m/s), the pedal inputs (0..1) and the parking brake, then sends.
+ */
+void SendHeadlessTruckData(HeadlessFramework& framework, float speed, float brake, float throttle,
+                           bool parking_brake = false);
+
+/**
+ * @brief Sends a game state event with the given pause flag and time scale.
+ */
+void SendHeadlessGameState(HeadlessFramework& framework, bool paused, float scale = 1.0f);
+
+/**
+ * @brief Calls the plugin's `OnGameWorldReady`, like the framework once the world is loaded.
+ */
+void SendHeadlessGameWorldReady(HeadlessFramework& framework);
+
+/**
+ * @brief The simulated clock of the active framework; meant to be injected as the plugin's clock.
+ */
+double HeadlessNow();
+
+}  // namespace SPF_FrontalBlindspotViewer::Headless
@@ -6,8 +6,11 @@
 #define _USE_MATH_DEFINES
 #include "SPF_FrontalBlindspotViewer.hpp" // Always include your own header first
 #include <cstring>                        // For C-style string manipulation functions like strncpy_s.
-#include <chrono>                         // For std::chrono for deltaTime calculation
+#include <chrono>                         // For std::chrono::steady_clock frame timestamps
 #include <cmath>                          // For std::sin, std::cos, std::fmod etc.
+#include <cstdio>                         // For snprintf
+#include <ctime>                          // For the trace file names
+#include <cfloat>                         // For FLT_MAX (profiler plot scale)
 
 namespace SPF_FrontalBlindspotViewer
 {
@@ -29,6 +32,21 @@ namespace SPF_FrontalBlindspotViewer
      */
     PluginContext g_ctx;
 
+    /**
+     * @brief The keybind action of every `PeekPreset`, in enum order (the front preset keeps "toggle").
+     */
+    const char *const PRESET_ACTIONS[kPeekPresetCount] = {"toggle", "peek_left_pillar", "peek_right_pillar", "peek_kerb"};
+
+    /**
+     * @brief The `user_data` of each preset keybind points at its entry here.
+     */
+    int PRESET_INDICES[kPeekPresetCount] = {kPeekPresetFront, kPeekPresetLeftPillar, kPeekPresetRightPillar, kPeekPresetKerb};
+
+    /**
+     * @brief The full name of the analog "hold to peek" action.
+     */
+    const char *const HOLD_ACTION = "SPF_FrontalBlindspotViewer.hold";
+
     // =================================================================================================
     // 2. Manifest Implementation
     // =================================================================================================
@@ -60,23 +78,14 @@ namespace SPF_FrontalBlindspotViewer
             // Enable specific systems in the settings UI.
             api->Policy_AddConfigurableSystem(h, "settings");
             api->Policy_AddConfigurableSystem(h, "localization");
+#if SPF_FBV_PROFILING
+            api->Policy_AddConfigurableSystem(h, "ui");
+#endif
         }
 
         // --- 2.3. Custom Settings Defaults ---
-        // A JSON string defines the default values for your plugin's custom settings.
-        api->Settings_SetJson(h, R"json(
-            {
-                "target_camera": {
-                    "position": { "x": -0.06, "y": -0.10, "z": -0.88 },
-                    "rotation": { "yaw": -0.03, "pitch": 0.58 },
-                    "fov": 80.0
-                },
-                "animation": {
-                    "speed": 1.1,
-                    "type": "live"
-                }
-            }
-        )json");
+        // Generated at compile time from kSettingSchema (see SettingsSchema.hpp).
+        api->Settings_SetJson(h, SettingsDefaultsJson());
 
         // --- 2.4. Default Settings for Framework Systems ---
 
@@ -89,58 +98,59 @@ namespace SPF_FrontalBlindspotViewer
         // Keybinds
         {
             api->Defaults_AddKeybind(h, "SPF_FrontalBlindspotViewer", "toggle", "keyboard", "KEY_F10", "always");
+            api->Defaults_AddKeybind(h, "SPF_FrontalBlindspotViewer", "hold", "keyboard", "KEY_F9", "always");
+            api->Defaults_AddKeybind(h, "SPF_FrontalBlindspotViewer", "peek_left_pillar", "chord", "keyboard:KEY_LCONTROL+keyboard:KEY_F9", "always");
+            api->Defaults_AddKeybind(h, "SPF_FrontalBlindspotViewer", "peek_right_pillar", "chord", "keyboard:KEY_LCONTROL+keyboard:KEY_F10", "always");
+            api->Defaults_AddKeybind(h, "SPF_FrontalBlindspotViewer", "peek_kerb", "chord", "keyboard:KEY_LCONTROL+keyboard:KEY_F11", "always");
         }
 
+#if SPF_FBV_PROFILING
+        // Windows
+        api->Defaults_AddWindow(h, "Profiler", false, true, 100, 100, 460, 560, false, false);
+#endif
+
         // =============================================================================================
         // 2.5. Metadata for UI Display (Optional)
         // =============================================================================================
 
         // --- Custom Settings Metadata ---
 
-        auto AddSliderMeta = [&](const char *key, const char *title, const char *desc, float min, float max, const char *format)
+        // Titles, descriptions and slider/combo parameters of every setting, generated at compile
+        // time from kSettingSchema.
+        for (int key = 0; key < static_cast<int>(SettingKey::Count); ++key)
         {
-            std::string params = "{ \"min\": " + std::to_string(min) +
-                                 ", \"max\": " + std::to_string(max) +
-                                 ", \"format\": \"" + format + "\" }";
-            api->Meta_AddCustomSetting(h, key, title, desc, "slider", params.c_str(), false);
-        };
-
-        //--- Metadata for target_camera.position.x ---
-        AddSliderMeta("target_camera.position.x", "settings.target_camera.position.x.title", "settings.target_camera.position.x.desc", -5.0f, 5.0f, "%.3f");
-
-        //--- Metadata for target_camera.position.y ---
-        AddSliderMeta("target_camera.position.y", "settings.target_camera.position.y.title", "settings.target_camera.position.y.desc", -5.0f, 5.0f, "%.3f");
-
-        //--- Metadata for target_camera.position.z ---
-        AddSliderMeta("target_camera.position.z", "settings.target_camera.position.z.title", "settings.target_camera.position.z.desc", -5.0f, 5.0f, "%.3f");
-
-        //--- Metadata for target_camera.rotation.yaw ---
-        AddSliderMeta("target_camera.rotation.yaw", "settings.target_camera.rotation.yaw.title", "settings.target_camera.rotation.yaw.desc", -3.1415f, 3.1415f, "%.3f");
-
-        //--- Metadata for target_camera.rotation.pitch ---
-        AddSliderMeta("target_camera.rotation.pitch", "settings.target_camera.rotation.pitch.title", "settings.target_camera.rotation.pitch.desc", -1.571f, 1.571f, "%.3f");
-
-        //--- Metadata for target_camera.fov ---
-        AddSliderMeta("target_camera.fov", "settings.target_camera.fov.title", "settings.target_camera.fov.desc", 30.0f, 120.0f, "%.1f");
-
-        //--- Metadata for animation.speed ---
-        AddSliderMeta("animation.speed", "settings.animation.speed.title", "settings.animation.speed.desc", 0.1f, 3.0f, "%.1f");
-
-        //--- Metadata for animation.type ---
-        const char *animation_type_options = R"json({ "options": [
-            { "value": "linear", "labelKey": "settings.animation_type_options.Linear" },
-            { "value": "live", "labelKey": "settings.animation_type_options.Live" }
-        ]})json";
-        api->Meta_AddCustomSetting(h, "animation.type", "settings.animation.type.title", "settings.animation.type.desc", "combo", animation_type_options, false);
+            SettingMeta meta;
+            if (GetSettingMeta(static_cast<SettingKey>(key), meta))
+            {
+                api->Meta_AddCustomSetting(h, meta.key, meta.title, meta.desc, meta.widget, meta.params, meta.hidden);
+            }
+        }
 
         //--- Metadata for the group labels ---
         api->Meta_AddCustomSetting(h, "target_camera", "settings.groups.target_camera.title", "settings.groups.target_camera.desc", nullptr, nullptr, false);
         api->Meta_AddCustomSetting(h, "animation", "settings.groups.animation.title", "settings.groups.animation.desc", nullptr, nullptr, false);
+        api->Meta_AddCustomSetting(h, "hold", "settings.groups.hold.title", "settings.groups.hold.desc", nullptr, nullptr, false);
+        api->Meta_AddCustomSetting(h, "stabilization", "settings.groups.stabilization.title", "settings.groups.stabilization.desc", nullptr, nullptr, false);
+        api->Meta_AddCustomSetting(h, "auto_peek", "settings.groups.auto_peek.title", "settings.groups.auto_peek.desc", nullptr, nullptr, false);
+        api->Meta_AddCustomSetting(h, "output", "settings.groups.output.title", "settings.groups.output.desc", nullptr, nullptr, false);
+        api->Meta_AddCustomSetting(h, "diagnostics", "settings.groups.diagnostics.title", "settings.groups.diagnostics.desc", nullptr, nullptr, false);
+
+        //--- The other presets are [x, y, z, yaw, pitch, fov] arrays, edited in settings.json ---
+        api->Meta_AddCustomSetting(h, "presets", "settings.groups.presets.title", "settings.groups.presets.desc", nullptr, nullptr, true);
         api->Meta_AddCustomSetting(h, "target_camera.position", "settings.groups.target_camera.position.title", "settings.groups.target_camera.position.desc", nullptr, nullptr, false);
         api->Meta_AddCustomSetting(h, "target_camera.rotation", "settings.groups.target_camera.rotation.title", "settings.groups.target_camera.rotation.desc", nullptr, nullptr, false);
 
         // Keybind Metadata
         api->Meta_AddKeybind(h, "SPF_FrontalBlindspotViewer", "toggle", "keybinds.toggle.title", "keybinds.toggle.desc");
+        api->Meta_AddKeybind(h, "SPF_FrontalBlindspotViewer", "hold", "keybinds.hold.title", "keybinds.hold.desc");
+        api->Meta_AddKeybind(h, "SPF_FrontalBlindspotViewer", "peek_left_pillar", "keybinds.peek_left_pillar.title", "keybinds.peek_left_pillar.desc");
+        api->Meta_AddKeybind(h, "SPF_FrontalBlindspotViewer", "peek_right_pillar", "keybinds.peek_right_pillar.title", "keybinds.peek_right_pillar.desc");
+        api->Meta_AddKeybind(h, "SPF_FrontalBlindspotViewer", "peek_kerb", "keybinds.peek_kerb.title", "keybinds.peek_kerb.desc");
+
+#if SPF_FBV_PROFILING
+        // Window Metadata
+        api->Meta_AddWindow(h, "Profiler", "windows.profiler.title", "windows.profiler.desc");
+#endif
     }
 
     // =================================================================================================
@@ -177,6 +187,11 @@ namespace SPF_FrontalBlindspotViewer
         if (g_ctx.loadAPI && g_ctx.loadAPI->config)
         {
             g_ctx.configHandle = g_ctx.loadAPI->config->Cfg_GetContext(PLUGIN_NAME);
+            if (g_ctx.configHandle)
+            {
+                // Writes the tuned truck poses off the frame thread (see SaveTruckProfiles).
+                StartConfigSaver(g_ctx.config_saver, WriteTruckProfiles, SaveConfigFile, nullptr);
+            }
         }
 
         // Localization API
@@ -209,22 +224,55 @@ namespace SPF_FrontalBlindspotViewer
             g_ctx.keybindsHandle = g_ctx.coreAPI->keybinds->Kbind_GetContext(PLUGIN_NAME);
             if (g_ctx.keybindsHandle)
             {
-                // Register the callback for our "toggle" action.
-                g_ctx.coreAPI->keybinds->Kbind_Register(g_ctx.keybindsHandle, "SPF_FrontalBlindspotViewer.toggle", OnKeybindAction);
+                // One callback for every preset action; the user data says which preset it is.
+                char action[64];
+                for (int preset = 0; preset < kPeekPresetCount; ++preset)
+                {
+                    snprintf(action, sizeof(action), "%s.%s", PLUGIN_NAME, PRESET_ACTIONS[preset]);
+                    g_ctx.coreAPI->keybinds->Kbind_Register_Ex(g_ctx.keybindsHandle, action, OnKeybindAction, &PRESET_INDICES[preset]);
+                }
+
+                // The hold value is polled per frame, but only once this has fired.
+                g_ctx.coreAPI->keybinds->Kbind_Register(g_ctx.keybindsHandle, HOLD_ACTION, OnHoldAction);
             }
         }
 
         // Camera API
         // Requires: SPF_Camera_API.h
+        // Not used until the service has found the interior camera (see UpdateCameraBinding).
         if (g_ctx.coreAPI && g_ctx.coreAPI->camera)
         {
-            g_ctx.cameraAPI = g_ctx.coreAPI->camera;
+            g_ctx.camera_service = g_ctx.coreAPI->camera;
+            StartCameraBinding(g_ctx.camera_binding, NowSeconds());
         }
 
-        // Load initial settings
-        LoadSettings();
+        // Telemetry API
+        // Requires: SPF_Telemetry_API.h
+        if (g_ctx.coreAPI && g_ctx.coreAPI->telemetry)
+        {
+            g_ctx.telemetryHandle = g_ctx.coreAPI->telemetry->Tel_GetContext(PLUGIN_NAME);
+            if (g_ctx.telemetryHandle)
+            {
+                // Fires when the player switches trucks; used to pick the truck's peek pose.
+                g_ctx.coreAPI->telemetry->Tel_RegisterForTruckConstants(g_ctx.telemetryHandle, OnTruckConstants, nullptr);
+                // Fires every frame; only stores a packed sample for the automatic peek.
+                g_ctx.coreAPI->telemetry->Tel_RegisterForTruckData(g_ctx.telemetryHandle, OnTruckData, nullptr);
+                // Fires when the game is paused or resumed; closes the camera gate.
+                g_ctx.coreAPI->telemetry->Tel_RegisterForGameState(g_ctx.telemetryHandle, OnGameState, nullptr);
+            }
+        }
+
+        // Environment API
+        // Requires: SPF_Environment_API.h
+        if (g_ctx.coreAPI && g_ctx.coreAPI->environment)
+        {
+            // Used for the location of trace files (diagnostics.trace_sessions).
+            g_ctx.environmentHandle = g_ctx.coreAPI->environment->Env_GetContext(PLUGIN_NAME);
+        }
 
-        g_ctx.lastFrameTime = std::chrono::high_resolution_clock::now();
+        // Load initial settings (the truck profiles included)
+        LoadSettings();
+        ApplyPublishedSettings();
     }
 
     void OnUpdate()
@@ -232,13 +280,57 @@ namespace SPF_FrontalBlindspotViewer
         // This function is called every frame while the plugin is active.
         // Avoid performing heavy or blocking operations here, as it will directly impact game performance.
 
+        SPF_FBV_PROFILE_SCOPE(g_ctx.profile[kProfileUpdate]);
+
+        // Read the clock once per frame; the animation is driven by this timestamp alone.
+        double now = NowSeconds();
+
+        // Until the camera service has found the interior camera there is nothing to animate.
+        if (!g_ctx.cameraAPI && !UpdateCameraBinding(now))
+        {
+            g_ctx.last_frame_time = now;
+            return;
+        }
+
+        // Paused, or another camera is shown: leave the camera alone and do nothing else. A running
+        // peek is frozen and continues from where it stopped once the interior camera is live
+        // again; settings and saves wait until then.
+        if (!UpdateCameraGateForFrame(now))
+        {
+            g_ctx.last_frame_time = now;
+            return;
+        }
+
+        // Settings changed since the last frame (published by OnSettingChanged)
+        ApplyPublishedSettings();
+
+        // Tuned truck poses, once the slider has come to rest
+        if (ConfigSaveDue(g_ctx.config_saver, now))
+        {
+            SaveTruckProfiles(false);
+        }
+
+        // A truck change (from OnTruckConstants) retargets the peek before this frame's step.
+        UpdateCurrentTruck();
+
+        // May start or end a peek before this frame's animation step.
+        UpdateAutoPeek(now);
+        UpdateCabinStabilization(now);
+
         if (g_ctx.isAnimating)
         {
-            auto currentTime = std::chrono::high_resolution_clock::now();
-            std::chrono::duration<float> deltaTime = currentTime - g_ctx.lastFrameTime;
-            AnimateCamera(deltaTime.count());
+            AnimateCamera(now);
+        }
+        else if (!g_ctx.isPeeking)
+        {
+            UpdateHoldPeek(now);
         }
-        g_ctx.lastFrameTime = std::chrono::high_resolution_clock::now();
+        g_ctx.last_frame_time = now;
+    }
+
+    void OnGameWorldReady()
+    {
+        WakeCameraBinding(g_ctx.camera_binding, NowSeconds());
     }
 
     void OnUnload()
@@ -257,6 +349,25 @@ namespace SPF_FrontalBlindspotViewer
         // Example: Unregistering keybinds (often handled by framework, but good practice if explicitly registered).
         // Requires: SPF_KeyBinds_API.h
 
+        // Flush and close a trace that is still being recorded.
+        StopTraceWriter(g_ctx.trace_writer);
+
+        // Save tuned poses that are still waiting for the sliders to settle.
+        if (g_ctx.config_saver.dirty)
+        {
+            SaveTruckProfiles(true);
+        }
+        StopConfigSaver(g_ctx.config_saver);
+        if (g_ctx.loadAPI && g_ctx.loggerHandle && g_ctx.formattingAPI && g_ctx.config_saver.changes > 0)
+        {
+            char log_buffer[256];
+            g_ctx.formattingAPI->Fmt_Format(log_buffer, sizeof(log_buffer), "Truck profiles saved %llu times for %llu edits (%llu coalesced).",
+                                            static_cast<unsigned long long>(g_ctx.config_saver.saves.load()),
+                                            static_cast<unsigned long long>(g_ctx.config_saver.changes.load()),
+                                            static_cast<unsigned long long>(g_ctx.config_saver.coalesced.load()));
+            g_ctx.loadAPI->logger->Log(g_ctx.loggerHandle, SPF_LOG_INFO, log_buffer);
+        }
+
         // Nullify all cached API pointers and handles.
         g_ctx.coreAPI = nullptr;
         g_ctx.loadAPI = nullptr;
@@ -268,6 +379,9 @@ namespace SPF_FrontalBlindspotViewer
         g_ctx.localizationHandle = nullptr;
         g_ctx.keybindsHandle = nullptr;
         g_ctx.cameraAPI = nullptr;
+        g_ctx.camera_service = nullptr;
+        g_ctx.telemetryHandle = nullptr;
+        g_ctx.environmentHandle = nullptr;
     }
 
     // =================================================================================================
@@ -275,6 +389,23 @@ namespace SPF_FrontalBlindspotViewer
     // =================================================================================================
 
     void LoadSettings()
+    {
+        // The whole `settings` tree in one pass if the framework hands it over; otherwise every
+        // known setting, once. OnSettingChanged normally reloads only the one that changed.
+        if (!LoadSettingsTree())
+        {
+            for (int key = 0; key < static_cast<int>(SettingKey::Count); ++key)
+            {
+                LoadSetting(static_cast<SettingKey>(key));
+            }
+        }
+        g_ctx.truck_profiles_loaded = true;
+
+        PublishSettings(g_ctx.settings_exchange, kAllSettings);
+        UpdateTraceWriter();
+    }
+
+    void LoadSetting(SettingKey key)
     {
         if (!g_ctx.configHandle || !g_ctx.loadAPI || !g_ctx.loadAPI->config)
         {
@@ -282,205 +413,1271 @@ namespace SPF_FrontalBlindspotViewer
         }
 
         auto config = g_ctx.loadAPI->config;
+        const SettingSchema &schema = GetSettingSchema(key);
+        SettingsSnapshot &staging = StagedSettings(g_ctx.settings_exchange);
 
-        // Load target camera position
-        g_ctx.target_pos[0] = config->Cfg_GetFloat(g_ctx.configHandle, "settings.target_camera.position.x", g_ctx.target_pos[0]);
-        g_ctx.target_pos[1] = config->Cfg_GetFloat(g_ctx.configHandle, "settings.target_camera.position.y", g_ctx.target_pos[1]);
-        g_ctx.target_pos[2] = config->Cfg_GetFloat(g_ctx.configHandle, "settings.target_camera.position.z", g_ctx.target_pos[2]);
+        // Read and stored as kSettingSchema describes; a missing value falls back to its default.
+        switch (schema.type)
+        {
+        case SettingType::Float:
+        case SettingType::Double:
+            StoreSettingValue(staging, schema, config->Cfg_GetFloat(g_ctx.configHandle, schema.path, static_cast<float>(schema.default_value)));
+            break;
+        case SettingType::Bool:
+            StoreSettingValue(staging, schema, config->Cfg_GetBool(g_ctx.configHandle, schema.path, schema.default_value != 0.0) ? 1.0 : 0.0);
+            break;
+        case SettingType::Choice:
+        {
+            // Parsed into an enum here so the frame loop never touches the string; an unknown
+            // value keeps the previous one.
+            char value[32];
+            config->Cfg_GetString(g_ctx.configHandle, schema.path, schema.options[static_cast<int>(schema.default_value)].value, value, sizeof(value));
+            int option = FindSettingOption(schema, value);
+            if (option >= 0)
+            {
+                StoreSettingValue(staging, schema, option);
+            }
+            break;
+        }
+        case SettingType::Pose:
+        case SettingType::Json:
+        default:
+            LoadJsonSetting(key, config->Cfg_GetJsonValueHandle(g_ctx.configHandle, schema.path));
+            break;
+        }
 
-        // Load target camera rotation
-        g_ctx.target_rot[0] = config->Cfg_GetFloat(g_ctx.configHandle, "settings.target_camera.rotation.yaw", g_ctx.target_rot[0]);
-        g_ctx.target_rot[1] = config->Cfg_GetFloat(g_ctx.configHandle, "settings.target_camera.rotation.pitch", g_ctx.target_rot[1]);
+        // The "hold to peek" input moves at most as fast as the animation.
+        staging.hold_filter.max_rate = staging.animation_speed;
+    }
 
-        // Load target FOV
-        g_ctx.target_fov = config->Cfg_GetFloat(g_ctx.configHandle, "settings.target_camera.fov", g_ctx.target_fov);
+    bool LoadSettingsTree()
+    {
+        if (!g_ctx.configHandle || !g_ctx.loadAPI || !g_ctx.loadAPI->config || !g_ctx.coreAPI || !g_ctx.coreAPI->json_reader)
+        {
+            return false;
+        }
 
-        // Load animation speed
-        g_ctx.animation_speed = config->Cfg_GetFloat(g_ctx.configHandle, "settings.animation.speed", g_ctx.animation_speed);
+        // One config call for the whole subtree instead of one path lookup per setting.
+        const SPF_JsonReader_API *json = g_ctx.coreAPI->json_reader;
+        SPF_JsonValue_Handle *root = g_ctx.loadAPI->config->Cfg_GetJsonValueHandle(g_ctx.configHandle, "settings");
+        if (!root || json->Json_GetType(root) != SPF_JSON_TYPE_OBJECT)
+        {
+            return false;
+        }
 
-        // Load animation type
-        char anim_type_buffer[32];
-        config->Cfg_GetString(g_ctx.configHandle, "settings.animation.type", g_ctx.animation_type.c_str(), anim_type_buffer, sizeof(anim_type_buffer));
-        g_ctx.animation_type = anim_type_buffer;
+        // A setting missing from the tree gets its default, as Cfg_Get* would return it.
+        SettingsSnapshot &staging = StagedSettings(g_ctx.settings_exchange);
+        ApplySettingDefaults(staging);
+        char path[128] = "settings";
+        LoadSettingsTreeNode(json, root, path, 8);
+        staging.hold_filter.max_rate = staging.animation_speed;
+        return true;
     }
 
-#pragma optimize("", off)
-    void AnimateCamera(float deltaTime)
+    void LoadSettingsTreeNode(const SPF_JsonReader_API *json, SPF_JsonValue_Handle *node, char *path, int length)
     {
-        if (!g_ctx.cameraAPI)
-            return;
+        constexpr int kPathCapacity = 128; // The buffer of LoadSettingsTree
+        int count = json->Json_GetObjectSize(node);
+        for (int i = 0; i < count; ++i)
+        {
+            // "<path>.<member>"; a name that does not fit is not one of ours.
+            path[length] = '.';
+            int written = json->Json_GetMemberName(node, i, path + length + 1, kPathCapacity - length - 1);
+            if (written <= 0 || length + 1 + written >= kPathCapacity)
+            {
+                continue;
+            }
 
-        // Internal marker for AV heuristics
-        const char *av_marker = "SPF_Camera_Animation_Logic_Safe";
+            SPF_JsonValue_Handle *value = json->Json_GetMemberValueByIndex(node, i);
+            SettingKey key = FindSettingKey(path);
+            if (key != SettingKey::Unknown)
+            {
+                LoadJsonSetting(key, value);
+            }
+            else if (value && json->Json_GetType(value) == SPF_JSON_TYPE_OBJECT)
+            {
+                LoadSettingsTreeNode(json, value, path, length + 1 + written); // A group
+            }
+        }
+        path[length] = '\0';
+    }
 
-        // Determine start and end points based on animation direction
-        float *start_pos_ptr, *end_pos_ptr;
-        float *start_rot_ptr, *end_rot_ptr;
-        float start_fov, end_fov;
+    void LoadJsonSetting(SettingKey key, SPF_JsonValue_Handle *value)
+    {
+        if (!value || !g_ctx.coreAPI || !g_ctx.coreAPI->json_reader)
+        {
+            return;
+        }
 
-        if (g_ctx.isPeeking)
-        { // Animating TO target
-            start_pos_ptr = g_ctx.original_pos;
-            start_rot_ptr = g_ctx.original_rot;
-            start_fov = g_ctx.original_fov;
-            end_pos_ptr = g_ctx.target_pos;
-            end_rot_ptr = g_ctx.target_rot;
-            end_fov = g_ctx.target_fov;
+        const SPF_JsonReader_API *json = g_ctx.coreAPI->json_reader;
+        const SettingSchema &schema = GetSettingSchema(key);
+        SettingsSnapshot &staging = StagedSettings(g_ctx.settings_exchange);
+        switch (schema.type)
+        {
+        case SettingType::Float:
+        case SettingType::Double:
+            StoreSettingValue(staging, schema, json->Json_GetFloat(value, schema.default_value));
+            break;
+        case SettingType::Bool:
+            StoreSettingValue(staging, schema, json->Json_GetBool(value, schema.default_value != 0.0) ? 1.0 : 0.0);
+            break;
+        case SettingType::Choice:
+        {
+            char text[32];
+            json->Json_GetString(value, text, sizeof(text));
+            int option = FindSettingOption(schema, text);
+            if (option >= 0)
+            {
+                StoreSettingValue(staging, schema, option);
+            }
+            break;
         }
-        else
-        { // Animating back FROM target
-            start_pos_ptr = g_ctx.target_pos;
-            start_rot_ptr = g_ctx.target_rot;
-            start_fov = g_ctx.target_fov;
-            end_pos_ptr = g_ctx.original_pos;
-            end_rot_ptr = g_ctx.original_rot;
-            end_fov = g_ctx.original_fov;
+        case SettingType::Pose:
+            // A whole [x, y, z, yaw, pitch, fov] array; a malformed one keeps the previous pose.
+            ReadJsonPose(value, SettingField<CameraPose>(staging, schema));
+            break;
+        case SettingType::Json:
+        default:
+            if (key == SettingKey::AnimationTimeline)
+            {
+                // Parsed into the keyframe arrays here; an invalid timeline keeps the previous one.
+                if (!ReadJsonTimeline(value, staging.timeline) && g_ctx.loggerHandle)
+                {
+                    g_ctx.loadAPI->logger->Log(g_ctx.loggerHandle, SPF_LOG_WARN, "animation.timeline is invalid (keys out of order or too many); keeping the previous timeline.");
+                }
+            }
+            else if (key == SettingKey::TruckProfiles && !g_ctx.truck_profiles_loaded)
+            {
+                ReadJsonTruckProfiles(value); // Afterwards written by the plugin itself
+            }
+            break;
         }
+    }
 
-        // Update progress
-        g_ctx.animation_progress += deltaTime * g_ctx.animation_speed;
+    void ApplyPublishedSettings()
+    {
+        // Called on the frame thread; usually a single atomic load that finds nothing new.
+        uint64_t seen = g_ctx.settings->generation;
+        if (!AcquireSettings(g_ctx.settings_exchange))
+        {
+            return;
+        }
 
-        // Check if animation is finished
-        if (g_ctx.animation_progress >= 1.0f)
+        // The snapshot is read where it lies; the previous one is the writer's again, so the
+        // tracks must not keep pointing into it.
+        g_ctx.settings = &CurrentSettings(g_ctx.settings_exchange);
+        const SettingsSnapshot &settings = *g_ctx.settings;
+        g_ctx.animation_track.timeline = &settings.timeline;
+        g_ctx.hold_track.timeline = &settings.timeline;
+        g_ctx.camera_writes.epsilon = settings.write_epsilon;
+
+        // Several slider ticks may arrive as one snapshot; each setting records the last one that changed it.
+        constexpr uint64_t kTargetSettings = SettingBit(SettingKey::TargetPosX) | SettingBit(SettingKey::TargetPosY) |
+                                             SettingBit(SettingKey::TargetPosZ) | SettingBit(SettingKey::TargetYaw) |
+                                             SettingBit(SettingKey::TargetPitch) | SettingBit(SettingKey::TargetFov) |
+                                             SettingBit(SettingKey::PresetLeftPillar) | SettingBit(SettingKey::PresetRightPillar) |
+                                             SettingBit(SettingKey::PresetKerb);
+        constexpr uint64_t kCurveSettings = SettingBit(SettingKey::AnimationType) | SettingBit(SettingKey::SpringStiffness) |
+                                            SettingBit(SettingKey::AnimationShortestRotation) | SettingBit(SettingKey::AnimationTimeline);
+        bool first = seen == 0;
+        bool target_changed = first || SettingsChangedSince(settings, kTargetSettings, seen);
+        bool curve_changed = target_changed || SettingsChangedSince(settings, kCurveSettings, seen);
+        bool speed_changed = SettingsChangedSince(settings, SettingBit(SettingKey::AnimationSpeed), seen);
+
+        // Edits of the target pose belong to the current truck (see UpdateTruckProfile); the
+        // initial load is not an edit.
+        if (target_changed)
         {
-            g_ctx.animation_progress = 1.0f;
-            g_ctx.isAnimating = false;
+            if (!first)
+                UpdateTruckProfile(g_ctx.front_preset_pose);
+            g_ctx.front_preset_pose = settings.presets.poses[kPeekPresetFront];
+            SelectTargetPose();
+        }
 
-            // Snap to final position to ensure precision
-            g_ctx.cameraAPI->Cam_SetInteriorSeatPos(end_pos_ptr[0], end_pos_ptr[1], end_pos_ptr[2]);
-            g_ctx.cameraAPI->Cam_SetInteriorHeadRot(end_rot_ptr[0], end_rot_ptr[1]);
-            g_ctx.cameraAPI->Cam_SetInteriorFov(end_fov);
-            return;
+        // A partial "hold" peek follows the new target right away.
+        if (g_ctx.isHolding && curve_changed)
+        {
+            PrepareHoldTrack();
+        }
+
+        // Keep an animation that is already running in sync with the new target and speed.
+        if (g_ctx.isAnimating && (curve_changed || speed_changed))
+        {
+            RetargetAnimation();
+        }
+
+        // If we are currently peeking, and a camera setting changes,
+        // apply it immediately for live preview.
+        if (g_ctx.isPeeking && !g_ctx.isAnimating && g_ctx.cameraAPI && target_changed)
+        {
+            // A slider tick moves a single channel, so the camera writer makes only that call.
+            ApplyCameraPose(MakeCameraPose(g_ctx.target_pos, g_ctx.target_rot, g_ctx.target_fov), true);
         }
+    }
 
-        float current_pos[3];
-        float current_rot[2];
-        float current_fov;
+    void SelectTargetPose()
+    {
+        // An array lookup, whatever the number of presets; the frame loop only reads `target_*`.
+        const CameraPose &pose = g_ctx.active_preset == kPeekPresetFront && g_ctx.current_truck_slot >= 0
+                                     ? g_ctx.truck_profiles.slots[g_ctx.current_truck_slot].pose
+                                     : g_ctx.settings->presets.poses[g_ctx.active_preset];
+        g_ctx.target_pos[0] = pose.pos[0];
+        g_ctx.target_pos[1] = pose.pos[1];
+        g_ctx.target_pos[2] = pose.pos[2];
+        g_ctx.target_rot[0] = pose.rot[0];
+        g_ctx.target_rot[1] = pose.rot[1];
+        g_ctx.target_fov = pose.fov;
+    }
 
-        if (g_ctx.animation_type == "live")
+    bool ReadJsonPose(SPF_JsonValue_Handle *value, CameraPose &pose)
+    {
+        // Poses are stored as [x, y, z, yaw, pitch, fov], in PoseChannel order.
+        if (!value || !g_ctx.coreAPI || !g_ctx.coreAPI->json_reader)
         {
-            // --- Live Animation Logic using a Bezier Curve ---
-            float p = g_ctx.animation_progress;
+            return false;
+        }
 
-            // A single, consistent easing for the entire animation path
-            auto easeInOutCubic = [](float t)
-            { return t < 0.5 ? 4 * t * t * t : 1 - std::pow(-2 * t + 2, 3) / 2; };
-            float eased_p = easeInOutCubic(p);
+        const SPF_JsonReader_API *json = g_ctx.coreAPI->json_reader;
+        if (json->Json_GetType(value) != SPF_JSON_TYPE_ARRAY || json->Json_GetArraySize(value) != kPoseChannelCount)
+        {
+            return false;
+        }
+        for (int c = 0; c < kPoseChannelCount; ++c)
+        {
+            SetPoseChannel(pose, c, static_cast<float>(json->Json_GetFloat(json->Json_GetArrayItem(value, c), GetPoseChannel(pose, c))));
+        }
+        return true;
+    }
 
-            // --- POSITION: Calculated along a Quadratic Bezier Curve ---
-            // This creates a natural arc instead of moving along straight axes.
-            // P0 is the start point.
-            // P2 is the end point.
-            // P1 is the control point that "pulls" the curve into an arc.
+    bool ReadJsonTimeline(SPF_JsonValue_Handle *value, PeekTimeline &timeline)
+    {
+        // { "<channel>": [{ "t": 0.45, "amount": 0.9, "offset": 0.0, "ease": "in_out" }, ...], ... }
+        // Channels that are left out move in one eased segment.
+        if (!value || !g_ctx.coreAPI || !g_ctx.coreAPI->json_reader)
+        {
+            return false;
+        }
 
-            float p1[3]; // The control point
-            // The horizontal position of the control point depends on the animation direction
-            // to make the "lift" feel natural when returning to the seat.
-            float horizontal_factor = g_ctx.isPeeking ? 0.2f : 0.8f;
-            p1[0] = start_pos_ptr[0] + (end_pos_ptr[0] - start_pos_ptr[0]) * horizontal_factor;
-            p1[2] = start_pos_ptr[2] + (end_pos_ptr[2] - start_pos_ptr[2]) * horizontal_factor;
+        const SPF_JsonReader_API *json = g_ctx.coreAPI->json_reader;
+        if (json->Json_GetType(value) != SPF_JSON_TYPE_OBJECT)
+        {
+            return false;
+        }
 
-            // Use the arc height fine-tuned by the user.
-            p1[1] = std::fmax(start_pos_ptr[1], end_pos_ptr[1]) + 0.15f;
+        PeekTimeline parsed;
+        TimelineKey keys[PeekTimeline::kMaxAuthoredKeys + 1];
+        for (int c = 0; c < kPoseChannelCount; ++c)
+        {
+            ResetTimelineChannel(parsed, c);
+            SPF_JsonValue_Handle *channel = json->Json_GetMember(value, kTimelineChannelNames[c]);
+            if (!channel)
+            {
+                continue;
+            }
 
-            // Quadratic Bezier curve formula: B(t) = (1-t)^2*P0 + 2*(1-t)*t*P1 + t^2*P2
-            auto bezier = [&](float t, float p0_coord, float p1_coord, float p2_coord)
+            int count = json->Json_GetArraySize(channel);
+            if (json->Json_GetType(channel) != SPF_JSON_TYPE_ARRAY || count > PeekTimeline::kMaxAuthoredKeys + 1)
+            {
+                return false;
+            }
+            for (int k = 0; k < count; ++k)
             {
-                float one_minus_t = 1.0f - t;
-                return one_minus_t * one_minus_t * p0_coord + 2.0f * one_minus_t * t * p1_coord + t * t * p2_coord;
-            };
+                SPF_JsonValue_Handle *item = json->Json_GetArrayItem(channel, k);
+                if (!item || json->Json_GetType(item) != SPF_JSON_TYPE_OBJECT)
+                {
+                    return false;
+                }
 
-            current_pos[0] = bezier(eased_p, start_pos_ptr[0], p1[0], end_pos_ptr[0]);
-            current_pos[1] = bezier(eased_p, start_pos_ptr[1], p1[1], end_pos_ptr[1]);
-            current_pos[2] = bezier(eased_p, start_pos_ptr[2], p1[2], end_pos_ptr[2]);
+                SPF_JsonValue_Handle *member = json->Json_GetMember(item, "t");
+                keys[k].time = member ? static_cast<float>(json->Json_GetFloat(member, -1.0)) : -1.0f;
+                member = json->Json_GetMember(item, "amount");
+                keys[k].amount = member ? static_cast<float>(json->Json_GetFloat(member, 1.0)) : 1.0f;
+                member = json->Json_GetMember(item, "offset");
+                keys[k].offset = member ? static_cast<float>(json->Json_GetFloat(member, 0.0)) : 0.0f;
+
+                char ease[16] = "in_out";
+                member = json->Json_GetMember(item, "ease");
+                if (member)
+                    json->Json_GetString(member, ease, sizeof(ease));
+                keys[k].easing = ParseTimelineEasing(ease, TimelineEasing::EaseInOut);
+            }
+            if (!SetTimelineChannel(parsed, c, keys, count))
+            {
+                return false;
+            }
+        }
 
-            // --- ROTATION ---
-            // Yaw (left/right rotation) follows the main eased progress.
-            current_rot[0] = start_rot_ptr[0] + (end_rot_ptr[0] - start_rot_ptr[0]) * eased_p;
+        timeline = parsed;
+        return true;
+    }
 
-            // Pitch (up/down rotation) for looking up at the end of the movement.
-            auto easeInQuad = [](float t)
-            { return t * t; };
-            float lookup_progress = std::fmax(0.0f, (p - 0.7f) / 0.3f);
-            float eased_lookup_progress = easeInQuad(lookup_progress);
-            current_rot[1] = start_rot_ptr[1] + (end_rot_ptr[1] - start_rot_ptr[1]) * eased_lookup_progress;
+    void ReadJsonTruckProfiles(SPF_JsonValue_Handle *profiles)
+    {
+        // Parsed once on activation; switching trucks afterwards is a table lookup.
+        if (!profiles || !g_ctx.coreAPI || !g_ctx.coreAPI->json_reader)
+        {
+            return;
+        }
 
-            // --- FOV ---
-            // Field of View animation remains linear for simplicity.
-            current_fov = start_fov + (end_fov - start_fov) * p;
+        const SPF_JsonReader_API *json = g_ctx.coreAPI->json_reader;
+        if (json->Json_GetType(profiles) != SPF_JSON_TYPE_ARRAY)
+        {
+            return;
         }
-        else
+
+        for (int i = 0; i < json->Json_GetArraySize(profiles); ++i)
         {
-            // --- Linear Interpolation (LERP) ---
-            // Fallback to the original linear animation.
-            current_pos[0] = start_pos_ptr[0] + (end_pos_ptr[0] - start_pos_ptr[0]) * g_ctx.animation_progress;
-            current_pos[1] = start_pos_ptr[1] + (end_pos_ptr[1] - start_pos_ptr[1]) * g_ctx.animation_progress;
-            current_pos[2] = start_pos_ptr[2] + (end_pos_ptr[2] - start_pos_ptr[2]) * g_ctx.animation_progress;
+            SPF_JsonValue_Handle *item = json->Json_GetArrayItem(profiles, i);
+            SPF_JsonValue_Handle *truck = item ? json->Json_GetMember(item, "truck") : nullptr;
+            SPF_JsonValue_Handle *pose = item ? json->Json_GetMember(item, "pose") : nullptr;
+            if (!truck || !pose || json->Json_GetArraySize(pose) != kPoseChannelCount)
+            {
+                continue;
+            }
+
+            // Stored as "brand_id/id"; split it back into the two telemetry strings.
+            char name[TruckIdentity::kNameSize];
+            json->Json_GetString(truck, name, sizeof(name));
+            char *separator = strchr(name, '/');
+            if (!separator)
+            {
+                continue;
+            }
+            *separator = '\0';
+            uint64_t key = HashTruckIdentity(name, separator + 1);
+            *separator = '/';
 
-            current_rot[0] = start_rot_ptr[0] + (end_rot_ptr[0] - start_rot_ptr[0]) * g_ctx.animation_progress;
-            current_rot[1] = start_rot_ptr[1] + (end_rot_ptr[1] - start_rot_ptr[1]) * g_ctx.animation_progress;
+            int slot = InsertTruckProfile(g_ctx.truck_profiles, key);
+            if (slot < 0)
+            {
+                break;
+            }
+            ReadJsonPose(pose, g_ctx.truck_profiles.slots[slot].pose);
+            memcpy(g_ctx.truck_profile_names[slot], name, sizeof(name));
+        }
+    }
 
-            current_fov = start_fov + (end_fov - start_fov) * g_ctx.animation_progress;
+    void SaveTruckProfiles(bool wait)
+    {
+        // Serialized on the frame thread, which owns the table, into the saver's fixed buffer.
+        ConfigSaver &saver = g_ctx.config_saver;
+        if (!saver.running.load(std::memory_order_acquire))
+        {
+            saver.dirty = false;
+            return;
         }
 
-        // Apply the calculated values to the camera
-        g_ctx.cameraAPI->Cam_SetInteriorSeatPos(current_pos[0], current_pos[1], current_pos[2]);
-        g_ctx.cameraAPI->Cam_SetInteriorHeadRot(current_rot[0], current_rot[1]);
-        g_ctx.cameraAPI->Cam_SetInteriorFov(current_fov);
+        char *text = saver.text;
+        int capacity = ConfigSaver::kTextCapacity - 1; // Room for the closing ']'
+        int length = snprintf(text, capacity, "[");
+        for (int slot = 0; slot < TruckProfileTable::kCapacity; ++slot)
+        {
+            const TruckProfileTable::Slot &profile = g_ctx.truck_profiles.slots[slot];
+            if (profile.key == 0)
+            {
+                continue;
+            }
+            const CameraPose &p = profile.pose;
+            int written = snprintf(text + length, capacity - length, "%s{ \"truck\": \"%s\", \"pose\": [%.4f, %.4f, %.4f, %.4f, %.4f, %.2f] }",
+                                   length > 1 ? ", " : "", g_ctx.truck_profile_names[slot], p.pos[0], p.pos[1], p.pos[2], p.rot[0], p.rot[1], p.fov);
+            if (written < 0 || written >= capacity - length)
+            {
+                text[length] = '\0';
+                break; // Cannot happen with kMaxCount profiles; keep the ones that fit
+            }
+            length += written;
+        }
+        text[length++] = ']';
+        text[length] = '\0';
+
+        // Busy with the previous save: the edits stay pending and the next frame tries again.
+        QueueConfigSave(saver, wait);
     }
-#pragma optimize("", on)
-    // Implement these functions if your plugin needs to react to specific events.
-    // Remember to also uncomment their prototypes in SPF_FrontalBlindspotViewer.hpp and register them
-    // in OnActivated or OnRegisterUI as appropriate.
 
-    void OnSettingChanged(SPF_Config_Handle *config_handle, const char *keyPath)
+    void WriteTruckProfiles(const char *json, void *)
     {
-        // A setting has changed. Check the keyPath and use the config_handle
-        // with the Config API to get the new value.
-        LoadSettings(); // Reload all settings
+        // Frame thread, under the saver's lock: the change notification arrives on this thread.
+        if (!g_ctx.configHandle || !g_ctx.loadAPI || !g_ctx.loadAPI->config)
+        {
+            return;
+        }
+        g_ctx.loadAPI->config->Cfg_SetJsonString(g_ctx.configHandle, "settings.truck_profiles", json);
+    }
 
-        // If we are currently peeking, and a camera setting changes,
-        // apply it immediately for live preview.
-        if (g_ctx.isPeeking && g_ctx.cameraAPI)
+    void SaveConfigFile(void *)
+    {
+        // Saver thread; Cfg_Save writes the config file to disk.
+        if (!g_ctx.configHandle || !g_ctx.loadAPI || !g_ctx.loadAPI->config)
+        {
+            return;
+        }
+        g_ctx.loadAPI->config->Cfg_Save(g_ctx.configHandle);
+    }
+
+    void UpdateTruckProfile(const CameraPose &previous_default)
+    {
+        // Slider edits go into the current truck's profile once it has one; while peeking at the
+        // front preset, the first edit creates it. Without a known truck the sliders only change
+        // the defaults.
+        bool peeking_front = g_ctx.isPeeking && g_ctx.active_preset == kPeekPresetFront;
+        if (g_ctx.current_truck.key == 0 || (g_ctx.current_truck_slot < 0 && !peeking_front))
+        {
+            return;
+        }
+
+        bool changed[kPoseChannelCount];
+        bool any_changed = false;
+        for (int c = 0; c < kPoseChannelCount; ++c)
+        {
+            changed[c] = GetPoseChannel(previous_default, c) != GetPoseChannel(g_ctx.settings->presets.poses[kPeekPresetFront], c);
+            any_changed = any_changed || changed[c];
+        }
+        if (!any_changed)
+        {
+            return;
+        }
+
+        int slot = g_ctx.current_truck_slot;
+        if (slot < 0)
         {
-            if (strstr(keyPath, "target_camera.position") ||
-                strstr(keyPath, "target_camera.rotation") ||
-                strstr(keyPath, "target_camera.fov"))
+            slot = InsertTruckProfile(g_ctx.truck_profiles, g_ctx.current_truck.key);
+            if (slot < 0)
             {
-                g_ctx.cameraAPI->Cam_SetInteriorSeatPos(g_ctx.target_pos[0], g_ctx.target_pos[1], g_ctx.target_pos[2]);
-                g_ctx.cameraAPI->Cam_SetInteriorHeadRot(g_ctx.target_rot[0], g_ctx.target_rot[1]);
-                g_ctx.cameraAPI->Cam_SetInteriorFov(g_ctx.target_fov);
+                if (g_ctx.loggerHandle)
+                    g_ctx.loadAPI->logger->Log(g_ctx.loggerHandle, SPF_LOG_WARN, "Truck profile table is full; the pose is not stored for this truck.");
+                return;
             }
+            // Start from the pose the user was looking at.
+            g_ctx.truck_profiles.slots[slot].pose = previous_default;
+            memcpy(g_ctx.truck_profile_names[slot], g_ctx.current_truck.name, sizeof(g_ctx.current_truck.name));
+            g_ctx.current_truck_slot = slot;
+        }
+
+        // Only the channels the user just moved; the rest of the truck's pose is kept.
+        CameraPose &pose = g_ctx.truck_profiles.slots[slot].pose;
+        for (int c = 0; c < kPoseChannelCount; ++c)
+        {
+            if (changed[c])
+                SetPoseChannel(pose, c, GetPoseChannel(g_ctx.settings->presets.poses[kPeekPresetFront], c));
         }
+
+        SelectTargetPose();
+        NoteConfigChange(g_ctx.config_saver, NowSeconds()); // Saved once the sliders settle
     }
 
-    void OnKeybindAction()
+    void OnTruckConstants(const SPF_TruckConstants *data, void *)
     {
-        // This function name should match what you passed to SPF_KeyBinds_API.Register.
-        if (g_ctx.isAnimating || !g_ctx.cameraAPI)
+        // Telemetry thread: only hand the identity over; the frame loop looks up its profile.
+        if (data)
         {
-            return; // Ignore keybind if already animating or camera API is not available
+            PublishTruckIdentity(g_ctx.truck_identity, data->brand_id, data->id);
         }
+    }
 
-        if (!g_ctx.isPeeking)
+    void UpdateCurrentTruck()
+    {
+        TruckIdentity truck;
+        if (!ReadTruckIdentity(g_ctx.truck_identity, g_ctx.truck_identity_seen, truck) || truck.key == g_ctx.current_truck.key)
         {
-            // Save current camera state
-            g_ctx.cameraAPI->Cam_GetInteriorSeatPos(&g_ctx.original_pos[0], &g_ctx.original_pos[1], &g_ctx.original_pos[2]);
-            g_ctx.cameraAPI->Cam_GetInteriorHeadRot(&g_ctx.original_rot[0], &g_ctx.original_rot[1]);
-            g_ctx.cameraAPI->Cam_GetInteriorFov(&g_ctx.original_fov);
+            return; // Nothing new, or the same truck (the constants are resent e.g. after loading a save)
+        }
+
+        g_ctx.current_truck = truck;
+        g_ctx.current_truck_slot = truck.key ? FindTruckProfile(g_ctx.truck_profiles, truck.key) : -1;
+        SelectTargetPose();
 
-            // Start animating to peek position
-            g_ctx.isPeeking = true;
+        // A running animation heads for the new truck's pose.
+        if (g_ctx.isAnimating)
+        {
+            RetargetAnimation();
         }
-        else
+
+        if (truck.key && g_ctx.loadAPI && g_ctx.loggerHandle && g_ctx.formattingAPI)
+        {
+            char log_buffer[256];
+            g_ctx.formattingAPI->Fmt_Format(log_buffer, sizeof(log_buffer), "Truck %s: using %s peek pose.", truck.name,
+                                            g_ctx.current_truck_slot >= 0 ? "its own" : "the default");
+            g_ctx.loadAPI->logger->Log(g_ctx.loggerHandle, SPF_LOG_INFO, log_buffer);
+        }
+    }
+
+    void OnTruckData(const SPF_TruckData *data, void *)
+    {
+        // Called for every telemetry frame: copy the few values the frame loop needs and leave.
+        if (!data)
         {
-            // Start animating back to original position
-            g_ctx.isPeeking = false;
+            return;
         }
 
-        g_ctx.isAnimating = true;
-        g_ctx.animation_progress = 0.0f; // Reset animation progress
+        AutoPeekSample sample;
+        sample.speed = data->speed;
+        sample.brake = data->input_brake;
+        sample.throttle = data->input_throttle;
+        sample.parking_brake = data->parking_brake;
+        g_ctx.auto_peek_sample.store(PackAutoPeekSample(sample), std::memory_order_relaxed);
+
+        // Cabin against chassis plus the simulated head against the cabin. The telemetry gives
+        // angles in rotations (1 = 360 degrees); the camera takes radians.
+        constexpr float kRotationsToRadians = 6.28318530718f;
+        CabinMotion motion;
+        motion.value[kCabinX] = data->cabin_offset.position.x + data->head_offset.position.x;
+        motion.value[kCabinY] = data->cabin_offset.position.y + data->head_offset.position.y;
+        motion.value[kCabinZ] = data->cabin_offset.position.z + data->head_offset.position.z;
+        motion.value[kCabinYaw] = data->cabin_offset.orientation.heading * kRotationsToRadians;
+        motion.value[kCabinPitch] = data->cabin_offset.orientation.pitch * kRotationsToRadians;
+        motion.rate[kCabinYaw] = data->cabin_angular_velocity.y * kRotationsToRadians;
+        motion.rate[kCabinPitch] = data->cabin_angular_velocity.x * kRotationsToRadians;
+        motion.has_rate[kCabinYaw] = true;
+        motion.has_rate[kCabinPitch] = true;
+        PublishCabinMotion(g_ctx.cabin_motion, motion);
+    }
+
+    void OnGameState(const SPF_GameState *data, void *)
+    {
+        if (data)
+        {
+            PublishGameState(g_ctx.camera_gate, data->paused, data->scale);
+        }
+    }
+
+    bool UpdateCameraGateForFrame(double now, bool refresh)
+    {
+        CameraGate &gate = g_ctx.camera_gate;
+
+        // Asked every frame while the answer decides about a write (or a hold is about to start),
+        // before a peek starts (`refresh`), after a game state change, and every so often while
+        // another camera keeps the gate closed; never while idle on an open gate.
+        bool busy = g_ctx.isAnimating || g_ctx.isPeeking || g_ctx.isHolding || g_ctx.hold_engaged;
+        if (g_ctx.cameraAPI && g_ctx.cameraAPI->Cam_GetCurrentCamera && CameraGateWantsQuery(gate, busy || refresh, now))
+        {
+            SPF_CameraType camera;
+            if (g_ctx.cameraAPI->Cam_GetCurrentCamera(&camera))
+            {
+                gate.interior = camera == SPF_CAMERA_INTERIOR;
+            }
+        }
+
+        if (UpdateCameraGate(gate) == CameraGateEvent::Opened && g_ctx.cameraAPI)
+        {
+            // The game may have reset the interior camera meanwhile; put back what was shown.
+            InvalidateCameraWriteCache(g_ctx.camera_writes);
+            if (g_ctx.isAnimating)
+            {
+                ResumeAnimationClock(g_ctx.animation_clock, now); // The next frame writes the pose
+            }
+            else if (g_ctx.isHolding)
+            {
+                CameraPose pose;
+                EvaluateTrack(*g_ctx.hold_kernel, g_ctx.hold_track, g_ctx.hold_filter.output, pose);
+                ApplyCameraPose(pose, true);
+            }
+            else if (g_ctx.isPeeking)
+            {
+                ApplyCameraPose(MakeCameraPose(g_ctx.target_pos, g_ctx.target_rot, g_ctx.target_fov), true);
+            }
+        }
+
+        if (!gate.open && !g_ctx.isHolding)
+        {
+            g_ctx.hold_engaged = false; // A hold pressed on another camera is not picked up later
+        }
+        return gate.open;
+    }
+
+    bool UpdateCameraBinding(double now)
+    {
+        const SPF_Camera_API *camera = g_ctx.camera_service;
+
+        // A game state change (loading done, paused, resumed) is a good moment to look again.
+        uint32_t game_states = g_ctx.camera_gate.changes.load(std::memory_order_acquire);
+        if (game_states != g_ctx.camera_binding.game_states)
+        {
+            g_ctx.camera_binding.game_states = game_states;
+            WakeCameraBinding(g_ctx.camera_binding, now);
+        }
+
+        if (!camera || !CameraBindingWantsProbe(g_ctx.camera_binding, now))
+        {
+            return false;
+        }
+
+        // A framework without the status calls is taken at its word, as before.
+        CameraProbe probe;
+        probe.service_ready = !camera->Cam_IsServiceReady || camera->Cam_IsServiceReady();
+        probe.interior_ready = probe.service_ready && (!camera->Cam_IsFinderReady || camera->Cam_IsFinderReady(kInteriorCameraFinder));
+
+        const CameraBinding &binding = g_ctx.camera_binding;
+        char log_buffer[256];
+        switch (ReportCameraProbe(g_ctx.camera_binding, now, probe))
+        {
+        case CameraBindingAction::Bind:
+            g_ctx.cameraAPI = camera;
+            if (g_ctx.loadAPI && g_ctx.loggerHandle && g_ctx.formattingAPI)
+            {
+                bool all_offsets = !camera->Cam_AreAllOffsetsFound || camera->Cam_AreAllOffsetsFound();
+                g_ctx.formattingAPI->Fmt_Format(log_buffer, sizeof(log_buffer), "Interior camera ready after %.2f s (%u probes, %u offset refreshes)%s.",
+                                                binding.time_to_ready, binding.probes, binding.refreshes,
+                                                all_offsets ? "" : "; some other camera offsets are missing");
+                g_ctx.loadAPI->logger->Log(g_ctx.loggerHandle, SPF_LOG_INFO, log_buffer);
+            }
+            return true;
+        case CameraBindingAction::RefreshOffsets:
+            // The pattern of the interior camera may no longer match (e.g. after a game update).
+            if (g_ctx.loadAPI && g_ctx.loggerHandle && g_ctx.formattingAPI)
+            {
+                g_ctx.formattingAPI->Fmt_Format(log_buffer, sizeof(log_buffer), "Interior camera not found after %.0f s; rescanning the camera offsets. Peeks are off until it is found.",
+                                                now - binding.started);
+                g_ctx.loadAPI->logger->Log(g_ctx.loggerHandle, SPF_LOG_WARN, log_buffer);
+            }
+            if (camera->Cam_RefreshOffsets)
+            {
+                camera->Cam_RefreshOffsets();
+            }
+            break;
+        case CameraBindingAction::None:
+        default:
+            break;
+        }
+        return false;
+    }
+
+    void UpdateAutoPeek(double now)
+    {
+        const AutoPeekSettings &settings = g_ctx.settings->auto_peek;
+        if (!settings.enabled && g_ctx.auto_peek.state == AutoPeekState::Disarmed)
+        {
+            return;
+        }
+
+        uint64_t word = g_ctx.auto_peek_sample.load(std::memory_order_relaxed);
+        if (word == 0)
+        {
+            return; // No truck data yet
+        }
+
+        switch (UpdateAutoPeekDetector(g_ctx.auto_peek, UnpackAutoPeekSample(word), now, settings))
+        {
+        case AutoPeekAction::Peek:
+            if (!g_ctx.cameraAPI || g_ctx.isPeeking || g_ctx.isAnimating || g_ctx.isHolding)
+            {
+                DisarmAutoPeek(g_ctx.auto_peek); // The user is already looking; leave the camera to them.
+                break;
+            }
+            PeekAtPreset(kPeekPresetFront); // The traffic light
+            if (!g_ctx.isAnimating && !g_ctx.isPeeking)
+            {
+                DisarmAutoPeek(g_ctx.auto_peek); // Refused (e.g. another camera); try again at the next stop.
+                break;
+            }
+            g_ctx.auto_peek_active = true;
+            break;
+        case AutoPeekAction::Return:
+            if (g_ctx.auto_peek_active && g_ctx.isPeeking)
+            {
+                TogglePeek();
+            }
+            g_ctx.auto_peek_active = false;
+            break;
+        case AutoPeekAction::None:
+            break;
+        }
+    }
+
+    void UpdateCabinStabilization(double now)
+    {
+        const CabinStabilizerSettings &settings = g_ctx.settings->stabilization;
+        bool resting_peek = g_ctx.isPeeking && !g_ctx.isAnimating && g_ctx.cameraAPI;
+        if (!settings.enabled)
+        {
+            if (g_ctx.stabilizer.primed)
+            {
+                // Just turned off: drop the correction and put a resting peek back on its pose.
+                ResetCabinStabilizer(g_ctx.stabilizer);
+                if (resting_peek)
+                    ApplyCameraPose(MakeCameraPose(g_ctx.target_pos, g_ctx.target_rot, g_ctx.target_fov), true);
+            }
+            return;
+        }
+
+        CabinMotion motion;
+        if (!ReadCabinMotion(g_ctx.cabin_motion, motion))
+        {
+            return; // No truck data yet, or it is being written right now
+        }
+
+        float dt = static_cast<float>(std::fmin(std::fmax(now - g_ctx.last_frame_time, 0.0), 0.1));
+        UpdateCabinStabilizer(g_ctx.stabilizer, motion, dt, settings);
+
+        // A resting peek is otherwise never rewritten; hold it against the rock. The camera
+        // writer skips the calls while the cabin is still.
+        if (resting_peek)
+        {
+            CameraPose pose = MakeCameraPose(g_ctx.target_pos, g_ctx.target_rot, g_ctx.target_fov);
+            ApplyCabinCorrection(g_ctx.stabilizer, 1.0f, pose);
+            ApplyCameraPose(pose);
+        }
+    }
+
+    void UpdateTraceWriter()
+    {
+        // Runs on the config side; the frame loop only ever pushes into the ring.
+        bool wanted = StagedSettings(g_ctx.settings_exchange).trace_sessions;
+        bool running = g_ctx.trace_writer.running.load(std::memory_order_acquire);
+        char log_buffer[512];
+
+        if (wanted && !running)
+        {
+            if (!g_ctx.coreAPI || !g_ctx.coreAPI->environment || !g_ctx.environmentHandle)
+            {
+                return;
+            }
+
+            const SPF_Environment_API *env = g_ctx.coreAPI->environment;
+            char path[400];
+            int length = env->Env_GetPluginLogsDir(g_ctx.environmentHandle, path, sizeof(path));
+            if (length <= 0 || length >= static_cast<int>(sizeof(path)) - 40)
+            {
+                return;
+            }
+            env->Env_CreatePath(g_ctx.environmentHandle, path);
+
+            // One file per recording, e.g. "peek_trace_20250101_120000.json".
+            if (path[length - 1] != '/' && path[length - 1] != '\\')
+            {
+                path[length++] = '/';
+            }
+            std::time_t now = std::time(nullptr);
+            std::strftime(path + length, sizeof(path) - length, "peek_trace_%Y%m%d_%H%M%S.json", std::localtime(&now));
+
+            bool started = StartTraceWriter(g_ctx.trace_writer, g_ctx.trace_ring, path);
+            if (g_ctx.loggerHandle && g_ctx.formattingAPI)
+            {
+                g_ctx.formattingAPI->Fmt_Format(log_buffer, sizeof(log_buffer), started ? "Recording peek traces to %s" : "Could not create the trace file %s", path);
+                g_ctx.loadAPI->logger->Log(g_ctx.loggerHandle, started ? SPF_LOG_INFO : SPF_LOG_WARN, log_buffer);
+            }
+        }
+        else if (!wanted && running)
+        {
+            StopTraceWriter(g_ctx.trace_writer);
+            if (g_ctx.loggerHandle && g_ctx.formattingAPI)
+            {
+                g_ctx.formattingAPI->Fmt_Format(log_buffer, sizeof(log_buffer), "Peek trace closed: %llu frames written, %llu dropped so far.",
+                                                static_cast<unsigned long long>(g_ctx.trace_writer.frames_written),
+                                                static_cast<unsigned long long>(g_ctx.trace_ring.dropped.load(std::memory_order_relaxed)));
+                g_ctx.loadAPI->logger->Log(g_ctx.loggerHandle, SPF_LOG_INFO, log_buffer);
+            }
+        }
+    }
+
+    void RecordTraceFrame(double now, float frame_time, float progress, const CameraPose &pose, const CameraWriteStats &before, uint8_t kind, uint8_t flags)
+    {
+        if (!g_ctx.settings->trace_sessions)
+        {
+            return;
+        }
+
+        // A fixed-size copy into the ring; a full ring drops the frame instead of waiting.
+        TraceFrame frame;
+        frame.time = now;
+        frame.frame_time = frame_time;
+        frame.progress = progress;
+        frame.pose = pose;
+        frame.calls_made = static_cast<uint16_t>(g_ctx.camera_writes.stats.calls_made - before.calls_made);
+        frame.calls_skipped = static_cast<uint16_t>(g_ctx.camera_writes.stats.calls_skipped - before.calls_skipped);
+        frame.kind = kind;
+        frame.flags = flags;
+        frame.session = g_ctx.trace_session;
+        PushTraceFrame(g_ctx.trace_ring, frame);
+    }
+
+    double NowSeconds()
+    {
+        if (g_ctx.clock)
+        {
+            return g_ctx.clock();
+        }
+
+        using Seconds = std::chrono::duration<double>;
+        return std::chrono::duration_cast<Seconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void AnimateCamera(double now)
+    {
+        SPF_FBV_PROFILE_SCOPE(g_ctx.profile[kProfileAnimate]);
+
+        if (!g_ctx.cameraAPI)
+            return;
+
+        // Progress comes from the trigger time, not from summed frame deltas.
+        AnimationClockTick tick = TickAnimationClock(g_ctx.animation_clock, now, g_ctx.settings->clock);
+        g_ctx.animation_progress = static_cast<float>(tick.progress);
+
+        if (tick.hitch && g_ctx.loadAPI && g_ctx.loggerHandle && g_ctx.formattingAPI)
+        {
+            char log_buffer[256];
+            g_ctx.formattingAPI->Fmt_Format(log_buffer, sizeof(log_buffer), "Frame hitch of %.0f ms during the animation (%llu so far).",
+                                            tick.frame_time * 1000.0, static_cast<unsigned long long>(g_ctx.animation_clock.hitch_count));
+            g_ctx.loadAPI->logger->LogThrottled(g_ctx.loggerHandle, SPF_LOG_DEBUG, "SPF_FrontalBlindspotViewer.animation.hitch", 1000, log_buffer);
+        }
+
+        const AnimationTrack &track = g_ctx.animation_track;
+        uint8_t trace_flags = (tick.hitch ? kTraceHitch : 0) | (track.towardsTarget ? kTraceTowardsTarget : 0);
+
+        // The cabin correction fades in with the peek and out on the way back, so the seat pose
+        // is still reached exactly.
+        bool stabilize = g_ctx.settings->stabilization.enabled;
+        float progress = std::fmin(g_ctx.animation_progress, 1.0f);
+        float peek_amount = g_ctx.peek_amount_start + ((track.towardsTarget ? 1.0f : 0.0f) - g_ctx.peek_amount_start) * progress;
+
+        // Check if animation is finished
+        if (g_ctx.animation_progress >= 1.0f)
+        {
+            g_ctx.animation_progress = 1.0f;
+            g_ctx.isAnimating = false;
+
+            // Snap to final position to ensure precision
+            CameraPose end = track.end;
+            if (stabilize)
+                ApplyCabinCorrection(g_ctx.stabilizer, peek_amount, end);
+            CameraWriteStats before = g_ctx.camera_writes.stats;
+            ApplyCameraPose(end, true);
+            RecordTraceFrame(now, static_cast<float>(tick.frame_time), 1.0f, end, before, kTraceAnimation, trace_flags);
+
+            if (g_ctx.loggerHandle && g_ctx.formattingAPI)
+            {
+                const CameraWriteStats &stats = g_ctx.camera_writes.stats;
+                char log_buffer[256];
+                g_ctx.formattingAPI->Fmt_Format(log_buffer, sizeof(log_buffer), "Camera writes so far: %llu made, %llu skipped.",
+                                                static_cast<unsigned long long>(stats.calls_made), static_cast<unsigned long long>(stats.calls_skipped));
+                g_ctx.loadAPI->logger->Log(g_ctx.loggerHandle, SPF_LOG_DEBUG, log_buffer);
+            }
+            return;
+        }
+
+        // The curve family was chosen when the animation was triggered (see PrepareAnimation).
+        CameraPose pose;
+        EvaluateTrack(*g_ctx.animation_kernel, track, g_ctx.animation_progress, pose);
+        if (stabilize)
+            ApplyCabinCorrection(g_ctx.stabilizer, peek_amount, pose);
+
+        // Apply the calculated values to the camera
+        CameraWriteStats before = g_ctx.camera_writes.stats;
+        ApplyCameraPose(pose);
+        RecordTraceFrame(now, static_cast<float>(tick.frame_time), g_ctx.animation_progress, pose, before, kTraceAnimation, trace_flags);
+    }
+
+    // Only this thin layer that hands the pose to the game is kept unoptimized for the AV heuristics.
+    // The interpolation math lives in the fully optimized Animation library.
+#if defined(_MSC_VER)
+#pragma optimize("", off)
+#endif
+    void ApplyCameraPose(const CameraPose &pose, bool exact)
+    {
+        // Only the channels that actually moved cross the framework boundary.
+        uint8_t writes = CollectCameraWrites(g_ctx.camera_writes, pose, exact);
+
+        if (writes & kWriteSeatPos)
+            g_ctx.cameraAPI->Cam_SetInteriorSeatPos(pose.pos[0], pose.pos[1], pose.pos[2]);
+        if (writes & kWriteHeadRot)
+            g_ctx.cameraAPI->Cam_SetInteriorHeadRot(pose.rot[0], pose.rot[1]);
+        if (writes & kWriteFov)
+            g_ctx.cameraAPI->Cam_SetInteriorFov(pose.fov);
+    }
+#if defined(_MSC_VER)
+#pragma optimize("", on)
+#endif
+
+    void PrepareAnimation()
+    {
+        // The start of the track (and its velocity) is set by whoever starts the segment; only
+        // the destination follows the settings, so a running animation can be updated in place.
+        AnimationTrack &track = g_ctx.animation_track;
+        track.towardsTarget = g_ctx.isPeeking;
+        track.stiffness = g_ctx.settings->spring_stiffness;
+        track.shortest_rotation = g_ctx.settings->shortest_rotation;
+        track.end = g_ctx.isPeeking ? MakeCameraPose(g_ctx.target_pos, g_ctx.target_rot, g_ctx.target_fov)
+                                    : MakeCameraPose(g_ctx.original_pos, g_ctx.original_rot, g_ctx.original_fov);
+        track.timeline = &g_ctx.settings->timeline;
+
+        // Pick the specialized kernel once; the frame loop only calls through the pointer.
+        g_ctx.animation_kernel = &SelectAnimationKernel(g_ctx.settings->animation_type);
+        g_ctx.animation_kernel->Prepare(track);
+    }
+
+    void RetargetAnimation()
+    {
+        AnimationTrack &track = g_ctx.animation_track;
+        if (g_ctx.animation_kernel != &SelectAnimationKernel(AnimationType::Spring) ||
+            g_ctx.settings->animation_type != AnimationType::Spring)
+        {
+            // The other curves follow the new end (and speed) in place.
+            PrepareAnimation();
+            SetAnimationClockSpeed(g_ctx.animation_clock, NowSeconds(), AnimationClockSpeed());
+            return;
+        }
+
+        // The spring is re-solved from where it is and how fast it moves.
+        float progress = g_ctx.animation_progress;
+        CameraPose pose, velocity;
+        EvaluateTrack(*g_ctx.animation_kernel, track, progress, pose);
+        EvaluateTrackVelocity(*g_ctx.animation_kernel, track, progress, velocity);
+        ScalePose(velocity, AnimationClockSpeed());
+
+        float target_amount = track.towardsTarget ? 1.0f : 0.0f;
+        g_ctx.peek_amount_start += (target_amount - g_ctx.peek_amount_start) * progress;
+        g_ctx.animation_progress = 0.0f;
+        track.start = pose;
+        track.start_velocity = CameraPose();
+        track.spring.velocity = velocity;
+        PrepareAnimation();
+        StartAnimationClock(g_ctx.animation_clock, NowSeconds(), AnimationClockSpeed());
+    }
+
+    float AnimationClockSpeed()
+    {
+        // Curves with their own time scale (the spring) take as long as they need.
+        if (g_ctx.animation_track.duration > 0.0f)
+            return 1.0f / g_ctx.animation_track.duration;
+
+        // A shorter segment (e.g. turning back halfway) takes proportionally less time.
+        return g_ctx.settings->animation_speed / std::fmax(g_ctx.animation_duration_scale, 0.2f);
+    }
+
+    void PrepareHoldTrack()
+    {
+        // The hold track always runs from the seat to the peek pose; releasing reads it backwards.
+        AnimationTrack &track = g_ctx.hold_track;
+        track.towardsTarget = true;
+        track.stiffness = g_ctx.settings->spring_stiffness;
+        track.shortest_rotation = g_ctx.settings->shortest_rotation;
+        track.start = MakeCameraPose(g_ctx.original_pos, g_ctx.original_rot, g_ctx.original_fov);
+        track.end = MakeCameraPose(g_ctx.target_pos, g_ctx.target_rot, g_ctx.target_fov);
+        track.start_velocity = CameraPose();
+        track.spring.velocity = CameraPose();
+        track.timeline = &g_ctx.settings->timeline;
+
+        g_ctx.hold_kernel = &SelectAnimationKernel(g_ctx.settings->animation_type);
+        g_ctx.hold_kernel->Prepare(track);
+    }
+
+    void UpdateHoldPeek(double now)
+    {
+        // Idle until the hold action fires: no per-frame query of the input.
+        if (!g_ctx.hold_engaged || !g_ctx.cameraAPI || !g_ctx.keybindsHandle || !g_ctx.coreAPI || !g_ctx.coreAPI->keybinds)
+            return;
+
+        // Digital keys report 0/1, triggers and pedals 0..1, an accumulator knob its current state.
+        float raw = g_ctx.coreAPI->keybinds->Kbind_GetActionValue(g_ctx.keybindsHandle, HOLD_ACTION);
+        float dt = static_cast<float>(std::fmin(std::fmax(now - g_ctx.last_frame_time, 0.0), 0.1));
+        bool changed = UpdateAnalogFilter(g_ctx.hold_filter, raw, dt, g_ctx.settings->hold_filter);
+
+        float amount = g_ctx.hold_filter.output;
+        if (!g_ctx.isHolding)
+        {
+            if (amount <= 0.0f)
+            {
+                g_ctx.hold_engaged = raw > 0.0f; // Let go before the filter moved: idle again
+                return;
+            }
+
+            // The input was just engaged: remember the seat pose and build the curve once.
+            g_ctx.cameraAPI->Cam_GetInteriorSeatPos(&g_ctx.original_pos[0], &g_ctx.original_pos[1], &g_ctx.original_pos[2]);
+            g_ctx.cameraAPI->Cam_GetInteriorHeadRot(&g_ctx.original_rot[0], &g_ctx.original_rot[1]);
+            g_ctx.cameraAPI->Cam_GetInteriorFov(&g_ctx.original_fov);
+            PrepareHoldTrack();
+            InvalidateCameraWriteCache(g_ctx.camera_writes);
+            g_ctx.isHolding = true;
+            ++g_ctx.trace_session;
+        }
+
+        if (!changed)
+            return;
+
+        if (amount <= 0.0f)
+        {
+            // Fully released: back exactly on the seat.
+            CameraWriteStats before = g_ctx.camera_writes.stats;
+            ApplyCameraPose(g_ctx.hold_track.start, true);
+            RecordTraceFrame(now, dt, 0.0f, g_ctx.hold_track.start, before, kTraceHold, 0);
+            g_ctx.isHolding = false;
+            g_ctx.hold_engaged = raw > 0.0f;
+            return;
+        }
+
+        CameraPose pose;
+        EvaluateTrack(*g_ctx.hold_kernel, g_ctx.hold_track, amount, pose);
+        CameraWriteStats before = g_ctx.camera_writes.stats;
+        ApplyCameraPose(pose, amount >= 1.0f);
+        RecordTraceFrame(now, dt, amount, pose, before, kTraceHold, kTraceTowardsTarget);
+    }
+
+    // Implement these functions if your plugin needs to react to specific events.
+    // Remember to also uncomment their prototypes in SPF_FrontalBlindspotViewer.hpp and register them
+    // in OnActivated or OnRegisterUI as appropriate.
+
+    void OnSettingChanged(SPF_Config_Handle *config_handle, const char *keyPath)
+    {
+        // A setting has changed. Only the one field behind keyPath is fetched from the config;
+        // a slider drag fires this many times per second. The frame loop picks the new values up
+        // in ApplyPublishedSettings, so nothing it reads is touched from here.
+        SPF_FBV_PROFILE_SCOPE(g_ctx.profile[kProfileSettingChanged]);
+
+        SettingKey key = FindSettingKey(keyPath);
+        if (key == SettingKey::TruckProfiles)
+        {
+            return; // Our own write from SaveTruckProfiles
+        }
+
+        if (key == SettingKey::Unknown)
+        {
+            LoadSettings(); // Not a single known setting (e.g. a whole group was reset)
+            return;
+        }
+
+        LoadSetting(key);
+        PublishSettings(g_ctx.settings_exchange, SettingBit(key));
+
+        if (key == SettingKey::TraceSessions)
+        {
+            UpdateTraceWriter();
+        }
+    }
+
+    void OnKeybindAction(const char *action_id, void *user_data)
+    {
+        // Registered once per preset through Kbind_Register_Ex; the user data is the preset index.
+        // Pressing a key during an automatic peek takes the camera over until the truck has
+        // driven off again.
+        int preset = user_data ? *static_cast<const int *>(user_data) : kPeekPresetFront;
+        if (preset < 0 || preset >= kPeekPresetCount)
+        {
+            return;
+        }
+
+        // The action must be the one registered for that preset (the id ends in ".<its name>").
+        if (action_id)
+        {
+            size_t length = strlen(action_id), name_length = strlen(PRESET_ACTIONS[preset]);
+            const char *name = action_id + length - name_length;
+            if (length <= name_length || name[-1] != '.' || strcmp(name, PRESET_ACTIONS[preset]) != 0)
+            {
+                return;
+            }
+        }
+
+        if (g_ctx.auto_peek_active)
+        {
+            g_ctx.auto_peek_active = false;
+            DisarmAutoPeek(g_ctx.auto_peek);
+        }
+        PeekAtPreset(preset);
+    }
+
+    void OnHoldAction()
+    {
+        g_ctx.hold_engaged = true;
+    }
+
+    void PeekAtPreset(int preset)
+    {
+        // The key of the preset being looked at goes back to the seat; any other preset key
+        // heads for its pose, from wherever the camera is.
+        bool back_to_seat = g_ctx.isPeeking && preset == g_ctx.active_preset;
+        StartPeekSegment(!back_to_seat, preset);
+    }
+
+    void TogglePeek()
+    {
+        StartPeekSegment(!g_ctx.isPeeking, g_ctx.active_preset);
+    }
+
+    void StartPeekSegment(bool towards_target, int preset)
+    {
+        if (!g_ctx.cameraAPI || g_ctx.isHolding)
+        {
+            return; // No camera API, or the "hold" input owns the camera
+        }
+        if (!UpdateCameraGateForFrame(NowSeconds(), true))
+        {
+            return; // Paused or on another camera: the key does nothing
+        }
+
+        AnimationTrack &track = g_ctx.animation_track;
+        CameraPose start_velocity;
+
+        // From one preset straight to another, without the seat in between.
+        bool switching = towards_target && g_ctx.isPeeking && preset != g_ctx.active_preset;
+
+        if (g_ctx.isAnimating)
+        {
+            // Turn around (or change the destination) mid-flight: continue from the current pose
+            // and velocity instead of waiting for the animation to finish or restarting it from
+            // one end.
+            float progress = g_ctx.animation_progress;
+            CameraPose pose;
+            EvaluateTrack(*g_ctx.animation_kernel, track, progress, pose);
+            EvaluateTrackVelocity(*g_ctx.animation_kernel, track, progress, start_velocity);
+
+            // How far between the seat (0) and the peek pose (1) the camera currently is.
+            float amount = g_ctx.peek_amount_start + ((track.towardsTarget ? 1.0f : 0.0f) - g_ctx.peek_amount_start) * progress;
+            float old_speed = AnimationClockSpeed();
+
+            g_ctx.isPeeking = towards_target;
+            g_ctx.peek_amount_start = amount;
+            g_ctx.animation_duration_scale = switching ? 1.0f : (towards_target ? 1.0f - amount : amount);
+            track.start = pose;
+
+            // Per second; the spring carries it itself, the other curves get it per unit of the
+            // new track's progress below.
+            ScalePose(start_velocity, old_speed);
+            track.spring.velocity = start_velocity;
+        }
+        else
+        {
+            if (!g_ctx.isPeeking)
+            {
+                // Save current camera state
+                g_ctx.cameraAPI->Cam_GetInteriorSeatPos(&g_ctx.original_pos[0], &g_ctx.original_pos[1], &g_ctx.original_pos[2]);
+                g_ctx.cameraAPI->Cam_GetInteriorHeadRot(&g_ctx.original_rot[0], &g_ctx.original_rot[1]);
+                g_ctx.cameraAPI->Cam_GetInteriorFov(&g_ctx.original_fov);
+                track.start = MakeCameraPose(g_ctx.original_pos, g_ctx.original_rot, g_ctx.original_fov);
+            }
+            else
+            {
+                // Start from the pose being peeked at: back to the seat, or on to another preset
+                track.start = MakeCameraPose(g_ctx.target_pos, g_ctx.target_rot, g_ctx.target_fov);
+            }
+            track.spring.velocity = CameraPose();
+
+            g_ctx.isPeeking = towards_target;
+            g_ctx.peek_amount_start = switching || !towards_target ? 1.0f : 0.0f;
+            g_ctx.animation_duration_scale = 1.0f;
+
+            // The camera may have been moved (e.g. by mouse look) since our last write.
+            InvalidateCameraWriteCache(g_ctx.camera_writes);
+        }
+
+        // Only now: the start of the segment may have been the previous preset's pose.
+        if (preset != g_ctx.active_preset)
+        {
+            g_ctx.active_preset = preset;
+            SelectTargetPose();
+        }
+
+        g_ctx.isAnimating = true;
+        g_ctx.animation_progress = 0.0f; // Reset animation progress
+        ++g_ctx.trace_session;
+
+        // Everything but the progress is fixed from here on, so prepare the path once.
+        PrepareAnimation();
+        ScalePose(start_velocity, 1.0f / AnimationClockSpeed());
+        SetTrackStartVelocity(*g_ctx.animation_kernel, track, start_velocity);
+        StartAnimationClock(g_ctx.animation_clock, NowSeconds(), AnimationClockSpeed());
+    }
+
+#if SPF_FBV_PROFILING
+    // =================================================================================================
+    // 5. Profiler Window (SPF_FBV_PROFILING builds only)
+    // =================================================================================================
+
+    namespace
+    {
+        const char *const kProfilePhaseNames[kProfilePhaseCount] = {"OnUpdate", "AnimateCamera", "OnSettingChanged"};
+        const char *const kProfileThrottleKeys[kProfilePhaseCount] = {
+            "SPF_FrontalBlindspotViewer.profile.update",
+            "SPF_FrontalBlindspotViewer.profile.animate",
+            "SPF_FrontalBlindspotViewer.profile.setting_changed",
+        };
+
+        // The non-empty part of a histogram, handed to the plot callback.
+        struct ProfilePlot
+        {
+            const LatencyHistogram *histogram;
+            int first_bucket;
+        };
+
+        float ProfilePlotValue(void *data, int idx)
+        {
+            const ProfilePlot *plot = static_cast<const ProfilePlot *>(data);
+            return static_cast<float>(plot->histogram->buckets[plot->first_bucket + idx].load(std::memory_order_relaxed));
+        }
+
+        void FormatProfileSummary(char *buffer, size_t size, int phase)
+        {
+            LatencySummary summary = SummarizeLatency(g_ctx.profile[phase]);
+            g_ctx.formattingAPI->Fmt_Format(buffer, size, "%s: %llu calls, p50 %.2f us, p99 %.2f us, max %.2f us", kProfilePhaseNames[phase],
+                                            static_cast<unsigned long long>(summary.count), summary.p50_ns / 1000.0, summary.p99_ns / 1000.0,
+                                            summary.max_ns / 1000.0);
+        }
+    } // namespace
+
+    void OnRegisterUI(SPF_UI_API *ui_api)
+    {
+        if (ui_api)
+        {
+            ui_api->UI_RegisterDrawCallback(PLUGIN_NAME, "Profiler", DrawProfilerWindow, nullptr);
+        }
+    }
+
+    void DrawProfilerWindow(SPF_UI_API *ui, void *)
+    {
+        if (!g_ctx.formattingAPI)
+        {
+            return;
+        }
+
+        char text[256];
+        for (int phase = 0; phase < kProfilePhaseCount; ++phase)
+        {
+            const LatencyHistogram &histogram = g_ctx.profile[phase];
+            FormatProfileSummary(text, sizeof(text), phase);
+            ui->UI_Text(text);
+
+            // Plot only the buckets between the fastest and the slowest call.
+            int first = 0;
+            int last = LatencyHistogram::kBucketCount - 1;
+            while (first < last && histogram.buckets[first].load(std::memory_order_relaxed) == 0)
+                ++first;
+            while (last > first && histogram.buckets[last].load(std::memory_order_relaxed) == 0)
+                --last;
+
+            ProfilePlot plot = {&histogram, first};
+            g_ctx.formattingAPI->Fmt_Format(text, sizeof(text), "##%s", kProfilePhaseNames[phase]);
+            char overlay[64];
+            g_ctx.formattingAPI->Fmt_Format(overlay, sizeof(overlay), "%.2f .. %.2f us", LatencyBucketLowerBound(first) / 1000.0,
+                                            LatencyBucketLowerBound(last) / 1000.0);
+            ui->UI_PlotHistogramCallback(text, ProfilePlotValue, &plot, last - first + 1, 0, overlay, 0.0f, FLT_MAX, 0.0f, 80.0f);
+            ui->UI_Separator();
+        }
+
+        // The debounced truck profile saves (see SaveTruckProfiles)
+        g_ctx.formattingAPI->Fmt_Format(text, sizeof(text), "Truck profile saves: %llu written, %llu of %llu edits coalesced",
+                                        static_cast<unsigned long long>(g_ctx.config_saver.saves.load(std::memory_order_relaxed)),
+                                        static_cast<unsigned long long>(g_ctx.config_saver.coalesced.load(std::memory_order_relaxed)),
+                                        static_cast<unsigned long long>(g_ctx.config_saver.changes.load(std::memory_order_relaxed)));
+        ui->UI_Text(text);
+
+        if (ui->UI_Button("Write to log", 0.0f, 0.0f))
+        {
+            LogProfileSummary();
+        }
+    }
+
+    void LogProfileSummary()
+    {
+        if (!g_ctx.loadAPI || !g_ctx.loggerHandle || !g_ctx.formattingAPI)
+        {
+            return;
+        }
+
+        char log_buffer[256];
+        for (int phase = 0; phase < kProfilePhaseCount; ++phase)
+        {
+            FormatProfileSummary(log_buffer, sizeof(log_buffer), phase);
+            g_ctx.loadAPI->logger->LogThrottled(g_ctx.loggerHandle, SPF_LOG_INFO, kProfileThrottleKeys[phase], 1000, log_buffer);
+        }
     }
+#endif
 
     // =================================================================================================
     // 6. Plugin Exports
@@ -519,8 +1716,12 @@ namespace SPF_FrontalBlindspotViewer
                 exports->OnActivated = OnActivated;
                 exports->OnUnload = OnUnload;
                 exports->OnUpdate = OnUpdate;
+                exports->OnGameWorldReady = OnGameWorldReady;
 
                 exports->OnSettingChanged = OnSettingChanged;
+#if SPF_FBV_PROFILING
+                exports->OnRegisterUI = OnRegisterUI;
+#endif
                 return true;
             }
             return false;
@@ -7,6 +7,8 @@
 // =================================================================================================
 // 1. SPF API Includes - Core & Essential
 // =================================================================================================
+#include <cstddef>  // For size_t, which SPF_Hooks_API.h uses without including it itself.
+
 #include <SPF_Plugin.h>
 #include <SPF_Manifest_API.h>
 #include <SPF_Logger_API.h>
@@ -16,20 +18,56 @@
 #include <SPF_Localization_API.h>   // For SPF_Localization_Handle
 #include <SPF_KeyBinds_API.h>       // For SPF_KeyBinds_Handle
 #include <SPF_Camera_API.h>         // For SPF_Camera_API
+#include <SPF_Telemetry_API.h>      // For SPF_Telemetry_Handle, SPF_TruckConstants and SPF_GameState
+#include <SPF_JsonReader_API.h>     // For reading the stored truck profiles
+#include <SPF_Environment_API.h>    // For the plugin's logs directory (trace files)
+#if SPF_FBV_PROFILING
+#include <SPF_UI_API.h>             // For the profiler window
+#endif
 
 // =================================================================================================
 // 2. Standard Library Includes
 // =================================================================================================
 #include <cstdint>  // For fixed-width integer types like int32_t, useful for consistent data sizes.
+#include <atomic>   // For std::atomic (the packed telemetry sample)
 #include <chrono>   // For std::chrono
 #include <string>   // For std::string
 
+#include "AnimationKernels.hpp" // For AnimationType, AnimationTrack, AnimationKernel and CameraPose
+#include "CameraWriter.hpp"     // For CameraWriteCache
+#include "AnimationClock.hpp"   // For AnimationClock and AnimationClockSettings
+#include "AnalogFilter.hpp"     // For AnalogFilter and AnalogFilterSettings
+#include "AutoPeek.hpp"         // For AutoPeekDetector and the packed telemetry sample
+#include "CabinStabilizer.hpp"  // For CabinStabilizer and CabinMotionExchange
+#include "CameraGate.hpp"       // For CameraGate
+#include "CameraBinding.hpp"    // For CameraBinding
+#include "PeekPresets.hpp"      // For PeekPreset
+#include "TruckProfiles.hpp"    // For TruckProfileTable and TruckIdentityExchange
+#include "SettingKeys.hpp"      // For SettingKey
+#include "SettingsSnapshot.hpp" // For SettingsSnapshot and SettingsExchange
+#include "SettingsSchema.hpp"   // For kSettingSchema and the generated manifest text
+#include "ConfigSaver.hpp"      // For ConfigSaver
+#include "LatencyHistogram.hpp" // For LatencyHistogram and SPF_FBV_PROFILE_SCOPE
+#include "TraceRecorder.hpp"    // For TraceRing and TraceWriter
+
 namespace SPF_FrontalBlindspotViewer {
 
 // =================================================================================================
 // 3. Core Plugin Architecture
 // =================================================================================================
 
+// --- Profiling ---
+
+/**
+ * @brief The entry points timed when the plugin is built with `SPF_FBV_PROFILING`.
+ */
+enum ProfilePhase {
+  kProfileUpdate = 0,     // OnUpdate
+  kProfileAnimate,        // AnimateCamera
+  kProfileSettingChanged, // OnSettingChanged
+  kProfilePhaseCount
+};
+
 // --- Plugin Context ---
 
 /**
@@ -59,26 +97,99 @@ struct PluginContext {
   SPF_Config_Handle* configHandle = nullptr;         // Requires: SPF_Config_API.h
   SPF_Localization_Handle* localizationHandle = nullptr; // Requires: SPF_Localization_API.h
   SPF_KeyBinds_Handle* keybindsHandle = nullptr;     // Requires: SPF_KeyBinds_API.h
-  const SPF_Camera_API* cameraAPI = nullptr;               // Requires: SPF_Camera_API.h
+  const SPF_Camera_API* cameraAPI = nullptr;               // Requires: SPF_Camera_API.h; null until bound
+  const SPF_Camera_API* camera_service = nullptr;          // coreAPI->camera, bound to cameraAPI once ready
+  SPF_Telemetry_Handle* telemetryHandle = nullptr;   // Requires: SPF_Telemetry_API.h
+  SPF_Environment_Handle* environmentHandle = nullptr; // Requires: SPF_Environment_API.h
 
   // --- Plugin State Variables (Optional - Uncomment/Add if needed) ---
   // Add any plugin-specific state variables here.
   bool isPeeking = false;
   bool isAnimating = false;
   float animation_progress = 0.0f;
+  float peek_amount_start = 0.0f;        // Where the current segment started: 0 = seat, 1 = peek pose
+  float animation_duration_scale = 1.0f; // Fraction of a full peek the current segment covers
 
-  // Settings cache
-  float animation_speed = 0.0f;
-  std::string animation_type = "live";
+  // Settings. OnSettingChanged edits StagedSettings(settings_exchange) in place and publishes it;
+  // the frame loop reads the snapshot it last took (see ApplyPublishedSettings) where it lies, so
+  // it never reads a half-updated value.
+  SettingsExchange settings_exchange;
+  const SettingsSnapshot* settings = &CurrentSettings(settings_exchange); // Read by the frame loop only
+  CameraPose front_preset_pose; // `settings->presets` front pose as of the last ApplyPublishedSettings
   float target_pos[3] = { 0.0f, 0.0f, 0.0f };
   float target_rot[2] = { 0.0f, 0.0f }; // yaw, pitch
   float target_fov = 0.0f;
 
+  // The preset the camera peeks (or last peeked) at. `target_*` is its pose from
+  // `settings.presets`; for the front preset, the current truck's profile if it has one.
+  int active_preset = kPeekPresetFront;
+
+  // Per-truck front peek poses, edited through the `target_camera` sliders.
+  TruckProfileTable truck_profiles;
+  bool truck_profiles_loaded = false; // Read by the first LoadSettings; the plugin owns them afterwards
+  char truck_profile_names[TruckProfileTable::kCapacity][TruckIdentity::kNameSize] = {}; // "brand_id/id" per slot
+  TruckIdentity current_truck; // Key 0 if unknown
+  int current_truck_slot = -1; // Its slot in `truck_profiles`, -1 if it has no profile
+  TruckIdentityExchange truck_identity; // Published by OnTruckConstants, applied by the frame loop
+  uint32_t truck_identity_seen = 0;     // Sequence of the last identity applied
+
   // Original camera state saved before peeking
   float original_pos[3] = { 0.0f, 0.0f, 0.0f };
   float original_rot[2] = { 0.0f, 0.0f }; // yaw, pitch
   float original_fov = 0.0f;
-  std::chrono::high_resolution_clock::time_point lastFrameTime; // For deltaTime calculation
+
+  // The current animation, prepared once when it is triggered.
+  AnimationTrack animation_track;
+  const AnimationKernel* animation_kernel = nullptr;
+
+  // "Hold to peek": the filtered analog action value is mapped straight onto its own peek track.
+  // The value is only polled between the action's callback and the release of the input.
+  bool isHolding = false;
+  bool hold_engaged = false; // Set by OnHoldAction
+  AnalogFilter hold_filter;
+  AnimationTrack hold_track;
+  const AnimationKernel* hold_kernel = nullptr;
+
+  // Automatic peek at stop lines (`auto_peek.*`). The truck data callback only stores the packed
+  // sample; the detector runs in OnUpdate.
+  std::atomic<uint64_t> auto_peek_sample{0}; // PackAutoPeekSample, 0 until the first update
+  AutoPeekDetector auto_peek;
+  bool auto_peek_active = false; // The current peek was started by the detector
+
+  // Cabin-motion compensation (`stabilization.*`): the truck data callback publishes the cabin
+  // motion, the frame loop filters it and offsets the peek pose against the rock.
+  CabinMotionExchange cabin_motion;
+  CabinStabilizer stabilizer;
+
+  // Closed while the game is paused or another camera is shown; nothing runs then and a
+  // running animation is frozen (see UpdateCameraGateForFrame).
+  CameraGate camera_gate;
+
+  // Probes the camera service until it finds the interior camera; only then is `cameraAPI` set
+  // (see UpdateCameraBinding), so every camera path is a no-op until the camera is confirmed.
+  CameraBinding camera_binding;
+
+  // The values last written to the camera, used to skip redundant Cam_Set* calls.
+  CameraWriteCache camera_writes;
+  AnimationClock animation_clock; // Drives animation_progress from frame timestamps
+  double (*clock)() = nullptr;    // Time source override (e.g. the headless stand-in's simulated clock)
+  double last_frame_time = 0.0;   // Timestamp of the last OnUpdate; the frame dt of the hold filter and stabilizer
+
+  // Opt-in frame recording (`diagnostics.trace_sessions`): the frame loop fills the ring, the
+  // writer's thread turns it into a trace file. Started and stopped by the config callbacks.
+  TraceRing trace_ring;
+  TraceWriter trace_writer;
+  uint32_t trace_session = 0; // Counts the peeks started, to tell them apart in the trace
+
+  // Debounced saving of the truck profiles: edits are noted by the frame loop and saved once the
+  // sliders settle, with Cfg_Save on the saver's thread. Started in OnLoad, flushed in OnUnload.
+  ConfigSaver config_saver;
+
+#if SPF_FBV_PROFILING
+  // Latency of the entry points: one fixed-size histogram of atomic bucket counters per
+  // ProfilePhase, held inline here. Nothing is allocated and no thread is started.
+  LatencyHistogram profile[kProfilePhaseCount];
+#endif
 };
 
 /**
@@ -126,6 +237,12 @@ void OnActivated(const SPF_Core_API* core_api);
  */
 void OnUpdate();
 
+/**
+ * @brief Called by the framework once the game world is loaded.
+ * @details Probes the camera service on the next frame if the camera is not bound yet.
+ */
+void OnGameWorldReady();
+
 /**
  * @brief Called last, just before the plugin is unloaded from memory.
  * @details Use this function to perform all necessary cleanup.
@@ -142,18 +259,80 @@ void OnUnload();
 void OnSettingChanged(SPF_Config_Handle *h, const char *keyPath);
 
 /**
- * @brief Callback executed when a keybind action is triggered by the user.
- * @details Uncomment this if your plugin defines keybinds in its manifest and needs to react
- *          to user input. You would typically register this callback in `OnActivated`.
- *          Requires: SPF_KeyBinds_API.h (for registration, but callback itself is void(void))
+ * @brief Callback executed when one of the preset keybinds is triggered by the user.
+ * @details Registered in `OnActivated` with `Kbind_Register_Ex`, once per `PeekPreset`.
+ *          Requires: SPF_KeyBinds_API.h
+ * @param action_id The full name of the action, e.g. "SPF_FrontalBlindspotViewer.toggle"; an
+ *        action other than the preset's own is ignored.
+ * @param user_data Points at the `PeekPreset` index of the keybind.
  */
-void OnKeybindAction();
+void OnKeybindAction(const char* action_id, void* user_data);
+
+/**
+ * @brief Callback of the "hold" keybind: starts polling its analog value in `UpdateHoldPeek`.
+ * @details Registered in `OnActivated` with `Kbind_Register`.
+ */
+void OnHoldAction();
+
+/**
+ * @brief Peeks at `preset`, or returns to the seat if the camera is already peeking at it.
+ * @details While peeking at another preset, the camera moves straight on to this one.
+ */
+void PeekAtPreset(int preset);
+
+/**
+ * @brief Starts the peek at the active preset, or the way back, from wherever the camera is.
+ * @details Used by the automatic peek to bring the camera back.
+ */
+void TogglePeek();
+
+/**
+ * @brief Starts an animation segment towards the pose of `preset` or, if `towards_target` is
+ * `false`, back to the seat. Starts from the current pose and velocity (also mid-animation).
+ */
+void StartPeekSegment(bool towards_target, int preset);
 
 // =================================================================================================
 // 4.2. Function Prototypes - Optional Helper Functions (Commented Out)
 // =================================================================================================
 // Add prototypes for any internal helper functions your plugin might need.
 void LoadSettings();
-void AnimateCamera(float deltaTime);
+void LoadSetting(SettingKey key);
+bool LoadSettingsTree();
+void LoadSettingsTreeNode(const SPF_JsonReader_API* json, SPF_JsonValue_Handle* node, char* path, int length);
+void LoadJsonSetting(SettingKey key, SPF_JsonValue_Handle* value);
+void ApplyPublishedSettings();
+void AnimateCamera(double now);
+double NowSeconds();
+void ApplyCameraPose(const CameraPose& pose, bool exact = false);
+void PrepareAnimation();
+void RetargetAnimation();
+void UpdateHoldPeek(double now);
+void PrepareHoldTrack();
+float AnimationClockSpeed();
+void SelectTargetPose();
+bool ReadJsonPose(SPF_JsonValue_Handle* value, CameraPose& pose);
+bool ReadJsonTimeline(SPF_JsonValue_Handle* value, PeekTimeline& timeline);
+void ReadJsonTruckProfiles(SPF_JsonValue_Handle* profiles);
+void SaveTruckProfiles(bool wait);
+void WriteTruckProfiles(const char* json, void* user_data);
+void SaveConfigFile(void* user_data);
+void UpdateTruckProfile(const CameraPose& previous_default);
+void OnTruckConstants(const SPF_TruckConstants* data, void* user_data);
+void UpdateCurrentTruck();
+void OnTruckData(const SPF_TruckData* data, void* user_data);
+void OnGameState(const SPF_GameState* data, void* user_data);
+bool UpdateCameraGateForFrame(double now, bool refresh = false);
+bool UpdateCameraBinding(double now);
+void UpdateAutoPeek(double now);
+void UpdateCabinStabilization(double now);
+void UpdateTraceWriter();
+void RecordTraceFrame(double now, float frame_time, float progress, const CameraPose& pose, const CameraWriteStats& before, uint8_t kind, uint8_t flags);
+
+#if SPF_FBV_PROFILING
+void OnRegisterUI(SPF_UI_API* ui_api);
+void DrawProfilerWindow(SPF_UI_API* ui, void* user_data);
+void LogProfileSummary();
+#endif
 
 }  // namespace SPF_FrontalBlindspotViewer
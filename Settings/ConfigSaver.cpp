@@ -0,0 +1,87 @@
+/**
+ * @file ConfigSaver.cpp
+ * @brief Implementation of the debounced config saver.
+ */
+
+#include "ConfigSaver.hpp"
+
+namespace SPF_FrontalBlindspotViewer
+{
+
+    namespace
+    {
+        void SaverLoop(ConfigSaver *saver)
+        {
+            std::unique_lock<std::mutex> lock(saver->mutex);
+            for (;;)
+            {
+                saver->wake.wait(lock, [saver] { return saver->save_requested || saver->stopping; });
+                if (!saver->save_requested)
+                    return; // Stopping with nothing left to write
+
+                // Under the lock: the frame loop does not change the config while it is written
+                // out, and skips its try until the next frame instead of waiting.
+                saver->save_requested = false;
+                saver->save(saver->user_data);
+                saver->saves.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    } // namespace
+
+    void StartConfigSaver(ConfigSaver &saver, ConfigWriteFn write, ConfigSaveFn save, void *user_data)
+    {
+        saver.write = write;
+        saver.save = save;
+        saver.user_data = user_data;
+        saver.save_requested = false;
+        saver.stopping = false;
+        saver.running.store(true, std::memory_order_release);
+        saver.thread = std::thread(SaverLoop, &saver);
+    }
+
+    void NoteConfigChange(ConfigSaver &saver, double now)
+    {
+        saver.changes.fetch_add(1, std::memory_order_relaxed);
+        if (saver.dirty)
+            saver.coalesced.fetch_add(1, std::memory_order_relaxed); // Rides along with the pending save
+        else
+            saver.first_change = now;
+        saver.dirty = true;
+        saver.last_change = now;
+    }
+
+    bool QueueConfigSave(ConfigSaver &saver, bool wait)
+    {
+        if (!saver.running.load(std::memory_order_acquire))
+            return false;
+
+        std::unique_lock<std::mutex> lock(saver.mutex, std::defer_lock);
+        if (wait)
+            lock.lock();
+        else if (!lock.try_lock())
+            return false;
+
+        saver.write(saver.text, saver.user_data);
+        if (saver.save_requested)
+            saver.coalesced.fetch_add(1, std::memory_order_relaxed); // The saver thread had not got to it yet
+        saver.save_requested = true;
+        lock.unlock();
+        saver.wake.notify_one();
+        saver.dirty = false;
+        return true;
+    }
+
+    void StopConfigSaver(ConfigSaver &saver)
+    {
+        if (!saver.running.exchange(false, std::memory_order_acq_rel))
+            return;
+
+        {
+            std::lock_guard<std::mutex> lock(saver.mutex);
+            saver.stopping = true;
+        }
+        saver.wake.notify_one();
+        saver.thread.join();
+    }
+
+} // namespace SPF_FrontalBlindspotViewer
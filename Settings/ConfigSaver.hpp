@@ -0,0 +1,103 @@
+/**
+ * @file ConfigSaver.hpp
+ * @brief Debounced config writes, saved to disk on a background thread.
+ *
+ * @details Values the plugin writes back itself (the per-truck poses tuned with the sliders)
+ * change many times per second while a slider is dragged, and `Cfg_Save` writes the whole config
+ * file. The frame loop therefore only notes that something changed (`NoteConfigChange`). Once the
+ * edits have stopped for `kQuietPeriod` (or have gone on for `kMaxDelay`), `ConfigSaveDue` turns
+ * true, and the frame loop serializes the current state once into `text`, a fixed buffer, and
+ * queues it (`QueueConfigSave`). Every edit in between is coalesced into that one save.
+ *
+ * Only the disk write leaves the frame thread. `QueueConfigSave` hands `text` to the `write`
+ * callback (`Cfg_SetJsonString`) on the frame thread, so the framework's change notification
+ * arrives there too; the saver thread then calls the `save` callback (`Cfg_Save`). Both run under
+ * the saver's lock, so the plugin never changes the config while it is being written out.
+ * Queueing only tries the lock, so the frame loop never waits for a save in progress; it tries
+ * again on the next frame. A save still pending when a newer state is queued is counted as
+ * coalesced. `StopConfigSaver` writes what is pending before it returns.
+ *
+ * The framework is assumed to guard its own config store, so `Cfg_Save` may run beside config
+ * reads on other threads; the lock only orders the plugin's own writes against its saves.
+ */
+#pragma once
+
+#include <atomic>             // For std::atomic
+#include <condition_variable> // For std::condition_variable
+#include <cstdint>            // For uint64_t
+#include <mutex>              // For std::mutex
+#include <thread>             // For std::thread
+
+namespace SPF_FrontalBlindspotViewer {
+
+/**
+ * @brief Puts the serialized state into the config; called on the frame thread.
+ */
+using ConfigWriteFn = void (*)(const char* text, void* user_data);
+
+/**
+ * @brief Writes the config to disk; called on the saver thread.
+ */
+using ConfigSaveFn = void (*)(void* user_data);
+
+/**
+ * @brief The pending edits and the thread that saves them.
+ */
+struct ConfigSaver {
+  static constexpr double kQuietPeriod = 2.0; // Seconds without an edit before saving
+  static constexpr double kMaxDelay = 10.0;   // A longer stream of edits is saved anyway
+  static constexpr int kTextCapacity = 64 * 1024;
+
+  // Owned by the frame loop; the counters may be read from anywhere.
+  bool dirty = false;
+  double first_change = 0.0; // Of the edits not yet queued
+  double last_change = 0.0;
+  char text[kTextCapacity] = {}; // The serialized state, filled before `QueueConfigSave`
+  std::atomic<uint64_t> changes{0};
+  std::atomic<uint64_t> coalesced{0}; // Edits that did not need a save of their own
+
+  // Shared with the saver thread.
+  std::thread thread;
+  std::mutex mutex; // Held by `write` and by `save`
+  std::condition_variable wake;
+  bool save_requested = false; // Guarded by `mutex`
+  bool stopping = false;
+  std::atomic<bool> running{false};
+  std::atomic<uint64_t> saves{0}; // Written to disk by the saver thread
+  ConfigWriteFn write = nullptr;
+  ConfigSaveFn save = nullptr;
+  void* user_data = nullptr;
+};
+
+/**
+ * @brief Starts the saver thread. Must not be called while it is running.
+ */
+void StartConfigSaver(ConfigSaver& saver, ConfigWriteFn write, ConfigSaveFn save, void* user_data);
+
+/**
+ * @brief Records an edit made at `now`; the save is due once the edits stop.
+ */
+void NoteConfigChange(ConfigSaver& saver, double now);
+
+/**
+ * @brief `true` if there are edits to save and they have settled (or waited too long).
+ */
+inline bool ConfigSaveDue(const ConfigSaver& saver, double now) {
+  return saver.dirty && (now - saver.last_change >= ConfigSaver::kQuietPeriod || now - saver.first_change >= ConfigSaver::kMaxDelay);
+}
+
+/**
+ * @brief Writes `saver.text` to the config, asks the saver thread to save it and clears the
+ * pending edits.
+ * @details Without `wait`, gives up if a save is in progress; the edits then stay pending and
+ * the caller tries again later.
+ * @return `false` if nothing was queued (busy, or the saver is not running).
+ */
+bool QueueConfigSave(ConfigSaver& saver, bool wait = false);
+
+/**
+ * @brief Writes what is still pending and joins the thread.
+ */
+void StopConfigSaver(ConfigSaver& saver);
+
+}  // namespace SPF_FrontalBlindspotViewer
@@ -0,0 +1,83 @@
+/**
+ * @file SettingKeys.cpp
+ * @brief Implementation of the hashed setting path lookup.
+ */
+
+#include "SettingKeys.hpp"
+#include "SettingsSchema.hpp" // For kSettingPaths
+#include <cstring> // For std::strncmp, std::strcmp
+
+namespace SPF_FrontalBlindspotViewer
+{
+
+    namespace
+    {
+        constexpr int kTableSize = 64; // Power of two, at least twice the number of keys.
+        constexpr int kKeyCount = static_cast<int>(SettingKey::Count);
+        static_assert(kTableSize >= 2 * kKeyCount, "Grow the setting lookup table");
+
+        constexpr char kPrefix[] = "settings.";
+        constexpr int kPrefixLength = sizeof(kPrefix) - 1;
+
+        static_assert([] {
+            for (int key = 0; key < kKeyCount; ++key)
+            {
+                for (int i = 0; i < kPrefixLength; ++i)
+                {
+                    if (kSettingPaths[key][i] != kPrefix[i])
+                        return false;
+                }
+            }
+            return true;
+        }(), "Every setting path starts with \"settings.\"");
+
+        struct LookupTable
+        {
+            uint64_t hashes[kTableSize] = {};
+            uint8_t keys[kTableSize] = {}; // SettingKey + 1, 0 = empty
+        };
+
+        // Built by the compiler; the hashes of all paths are known at compile time.
+        constexpr LookupTable BuildLookupTable()
+        {
+            LookupTable table;
+            for (int key = 0; key < kKeyCount; ++key)
+            {
+                uint64_t hash = HashSettingPath(kSettingPaths[key] + kPrefixLength);
+                int index = static_cast<int>(hash & (kTableSize - 1));
+                while (table.keys[index] != 0)
+                    index = (index + 1) & (kTableSize - 1);
+                table.hashes[index] = hash;
+                table.keys[index] = static_cast<uint8_t>(key + 1);
+            }
+            return table;
+        }
+
+        constexpr LookupTable kLookup = BuildLookupTable();
+    } // namespace
+
+    SettingKey FindSettingKey(const char *keyPath)
+    {
+        if (!keyPath)
+            return SettingKey::Unknown;
+
+        // Only the part after the "settings." prefix is hashed and compared; every path has it.
+        if (std::strncmp(keyPath, kPrefix, kPrefixLength) == 0)
+            keyPath += kPrefixLength;
+        uint64_t hash = HashSettingPath(keyPath);
+
+        for (int index = static_cast<int>(hash & (kTableSize - 1));; index = (index + 1) & (kTableSize - 1))
+        {
+            uint8_t slot = kLookup.keys[index];
+            if (slot == 0)
+                return SettingKey::Unknown;
+            if (kLookup.hashes[index] == hash)
+            {
+                // Confirm, so a hash collision with a foreign path cannot update the wrong field.
+                if (std::strcmp(kSettingPaths[slot - 1] + kPrefixLength, keyPath) == 0)
+                    return static_cast<SettingKey>(slot - 1);
+            }
+        }
+    }
+
+} // namespace SPF_FrontalBlindspotViewer
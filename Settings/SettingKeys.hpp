@@ -0,0 +1,88 @@
+/**
+ * @file SettingKeys.hpp
+ * @brief Compile-time table of the plugin's setting paths and a hashed lookup by key path.
+ *
+ * @details `OnSettingChanged` receives the path of the one setting that changed. Instead of
+ * re-reading every setting and matching the path with a chain of `strstr` calls, the path is
+ * hashed (FNV-1a, past the common `settings.` prefix) and looked up in an open-addressing table
+ * that is built at compile time, so only the affected field has to be fetched from the config. The paths themselves are part of
+ * the settings schema (see SettingsSchema.hpp).
+ *
+ * This header is part of the plugin's SPF-free core library and builds on every platform.
+ */
+#pragma once
+
+#include <cstdint> // For uint8_t, uint64_t
+
+namespace SPF_FrontalBlindspotViewer {
+
+// =================================================================================================
+// 1. Setting Keys
+// =================================================================================================
+
+/**
+ * @brief Every setting the plugin reads. The first six match the `PoseChannel` order.
+ */
+enum class SettingKey : uint8_t {
+  TargetPosX = 0,
+  TargetPosY,
+  TargetPosZ,
+  TargetYaw,
+  TargetPitch,
+  TargetFov,
+  AnimationSpeed,
+  AnimationType,
+  AnimationMaxStep,
+  SpringStiffness,
+  AnimationTimeline,
+  AnimationShortestRotation,
+  HoldSmoothing,
+  HoldDeadband,
+  AutoPeekEnabled,
+  AutoPeekDwell,
+  AutoPeekStopSpeed,
+  AutoPeekResumeSpeed,
+  StabilizationEnabled,
+  StabilizationStrength,
+  StabilizationMinCutoff,
+  StabilizationBeta,
+  OutputWriteEpsilon,
+  TraceSessions,
+  PresetLeftPillar,
+  PresetRightPillar,
+  PresetKerb,
+  TruckProfiles,
+  Count,
+  Unknown = Count
+};
+
+/**
+ * @brief `true` for the six `target_camera` channels.
+ */
+constexpr bool IsTargetCameraSetting(SettingKey key) {
+  return key <= SettingKey::TargetFov;
+}
+
+// =================================================================================================
+// 2. Lookup
+// =================================================================================================
+
+/**
+ * @brief Continues a 64-bit FNV-1a hash over a NUL-terminated string.
+ */
+constexpr uint64_t HashSettingPath(const char* text, uint64_t hash = 14695981039346656037ull) {
+  for (; *text; ++text) {
+    hash ^= static_cast<unsigned char>(*text);
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+/**
+ * @brief Maps the key path passed to `OnSettingChanged` to its `SettingKey`.
+ * @details Accepts the path with or without the leading `settings.`. Returns
+ * `SettingKey::Unknown` for paths the plugin does not know (e.g. whole groups).
+ */
+SettingKey FindSettingKey(const char* keyPath);
+
+}  // namespace SPF_FrontalBlindspotViewer
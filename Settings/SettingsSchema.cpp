@@ -0,0 +1,57 @@
+/**
+ * @file SettingsSchema.cpp
+ * @brief Implementation of the schema-driven setting stores.
+ */
+
+#include "SettingsSchema.hpp"
+#include <cstring> // For std::strcmp
+
+namespace SPF_FrontalBlindspotViewer
+{
+
+    void StoreSettingValue(SettingsSnapshot &snapshot, const SettingSchema &schema, double shown)
+    {
+        if (schema.min >= 0.0 && !(shown >= 0.0)) // Also catches NaN
+            shown = 0.0;
+
+        switch (schema.type)
+        {
+        case SettingType::Float:
+            SettingField<float>(snapshot, schema) = static_cast<float>(shown * schema.scale);
+            break;
+        case SettingType::Double:
+            SettingField<double>(snapshot, schema) = shown * schema.scale;
+            break;
+        case SettingType::Bool:
+            SettingField<bool>(snapshot, schema) = shown != 0.0;
+            break;
+        case SettingType::Choice:
+            if (shown < schema.option_count)
+                SettingField<uint8_t>(snapshot, schema) = static_cast<uint8_t>(shown);
+            break;
+        case SettingType::Pose:
+        case SettingType::Json:
+        default:
+            break;
+        }
+    }
+
+    void ApplySettingDefaults(SettingsSnapshot &snapshot)
+    {
+        for (const SettingSchema &schema : kSettingSchema)
+        {
+            StoreSettingValue(snapshot, schema, schema.default_value);
+        }
+    }
+
+    int FindSettingOption(const SettingSchema &schema, const char *value)
+    {
+        for (int option = 0; option < schema.option_count; ++option)
+        {
+            if (std::strcmp(schema.options[option].value, value) == 0)
+                return option;
+        }
+        return -1;
+    }
+
+} // namespace SPF_FrontalBlindspotViewer
@@ -0,0 +1,586 @@
+/**
+ * @file SettingsSchema.hpp
+ * @brief The one table that describes every setting: path, type, default, UI range and field.
+ *
+ * @details Each `SettingKey` has one `SettingSchema` entry. From the table alone, at compile time,
+ * come:
+ * - the config paths that `FindSettingKey` hashes (`kSettingPaths`),
+ * - the manifest's default settings JSON (`SettingsDefaultsJson`),
+ * - the title and description localization keys and the slider/combo parameters passed to
+ *   `Meta_AddCustomSetting` (`GetSettingMeta`),
+ * - and where the loaded value goes in the `SettingsSnapshot` (`StoreSettingValue`).
+ *
+ * Building the manifest therefore allocates nothing, and a new scalar setting is one line in
+ * `kSettingSchema` (plus its enum entry, field and texts): loading it, incrementally too, needs no
+ * code of its own. Values are stored in the unit of their field; `scale` converts from the unit
+ * shown to the user (e.g. milliseconds to seconds).
+ *
+ * This header is part of the plugin's SPF-free core library and builds on every platform.
+ */
+#pragma once
+
+#include <array>   // For std::array
+#include <cstddef> // For size_t, offsetof
+#include <cstdint> // For uint8_t, uint32_t
+
+#include "PeekPresets.hpp"      // For kDefaultPeekPresets
+#include "SettingKeys.hpp"      // For SettingKey
+#include "SettingsSnapshot.hpp" // For SettingsSnapshot
+
+namespace SPF_FrontalBlindspotViewer {
+
+// =================================================================================================
+// 1. Schema
+// =================================================================================================
+
+/**
+ * @brief How a setting is read from the config and stored.
+ */
+enum class SettingType : uint8_t {
+  Float = 0, // Cfg_GetFloat into a float
+  Double,    // Cfg_GetFloat into a double
+  Bool,      // Cfg_GetBool into a bool
+  Choice,    // Cfg_GetString, stored as the index of the option (a uint8_t enum)
+  Pose,      // An [x, y, z, yaw, pitch, fov] array into a CameraPose
+  Json       // Any other JSON value; parsed by the plugin itself
+};
+
+/**
+ * @brief How a setting is shown in the settings UI.
+ */
+enum class SettingWidget : uint8_t {
+  None = 0, // No metadata of its own (e.g. part of a group that is edited in settings.json)
+  Slider,
+  Checkbox,
+  Combo,
+  Hidden    // Metadata, but not shown
+};
+
+/**
+ * @brief One value of a `Choice` setting.
+ */
+struct SettingOption {
+  const char* value;     // As stored in the config
+  const char* label_key; // Localization key of the combo entry
+};
+
+/**
+ * @brief Everything the plugin knows about one setting.
+ */
+struct SettingSchema {
+  SettingKey key;
+  const char* path; // Full config path, `settings.` included
+  SettingType type;
+  SettingWidget widget;
+  size_t offset = 0;          // Of the field in SettingsSnapshot; unused for Json
+  double default_value = 0.0; // As shown to the user (Bool: 0 or 1, Choice: option index)
+  double min = 0.0;           // Slider range, as shown; a range from 0 up also keeps the value >= 0
+  double max = 0.0;
+  const char* format = nullptr; // Slider format
+  double scale = 1.0;           // Stored value = shown value * scale
+  const SettingOption* options = nullptr;
+  uint8_t option_count = 0;
+  const char* default_json = nullptr; // Json: the default as JSON text
+  const CameraPose* default_pose = nullptr; // Pose: the default
+};
+
+// --- Field offsets ---
+// Built from single-member `offsetof`s: array designators such as `offsetof(T, a[i].b)` are a
+// GCC/Clang extension that MSVC rejects.
+
+/**
+ * @brief Offset of the pose of `preset` in `SettingsSnapshot`.
+ */
+constexpr size_t PresetPoseOffset(int preset) {
+  return offsetof(SettingsSnapshot, presets) + offsetof(PeekPresetTable, poses) + static_cast<size_t>(preset) * sizeof(CameraPose);
+}
+
+/**
+ * @brief Offset of one `PoseChannel` within a `CameraPose`.
+ */
+constexpr size_t PoseChannelOffset(int channel) {
+  return channel <= kPosZ    ? offsetof(CameraPose, pos) + static_cast<size_t>(channel - kPosX) * sizeof(float)
+         : channel <= kPitch ? offsetof(CameraPose, rot) + static_cast<size_t>(channel - kYaw) * sizeof(float)
+                             : offsetof(CameraPose, fov);
+}
+
+// --- Table helpers, one per kind of setting ---
+
+constexpr SettingSchema SliderSetting(SettingKey key, const char* path, SettingType type, size_t offset, double default_value,
+                                      double min, double max, const char* format, double scale = 1.0) {
+  return {key, path, type, SettingWidget::Slider, offset, default_value, min, max, format, scale};
+}
+
+constexpr SettingSchema CheckboxSetting(SettingKey key, const char* path, size_t offset, bool default_value) {
+  return {key, path, SettingType::Bool, SettingWidget::Checkbox, offset, default_value ? 1.0 : 0.0};
+}
+
+template <size_t N>
+constexpr SettingSchema ComboSetting(SettingKey key, const char* path, size_t offset, uint8_t default_option,
+                                     const SettingOption (&options)[N]) {
+  SettingSchema schema{key, path, SettingType::Choice, SettingWidget::Combo, offset, static_cast<double>(default_option)};
+  schema.options = options;
+  schema.option_count = static_cast<uint8_t>(N);
+  return schema;
+}
+
+constexpr SettingSchema PoseSetting(SettingKey key, const char* path, size_t offset, const CameraPose& default_pose) {
+  SettingSchema schema{key, path, SettingType::Pose, SettingWidget::None, offset};
+  schema.default_pose = &default_pose;
+  return schema;
+}
+
+constexpr SettingSchema JsonSetting(SettingKey key, const char* path, const char* default_json) {
+  SettingSchema schema{key, path, SettingType::Json, SettingWidget::Hidden};
+  schema.default_json = default_json;
+  return schema;
+}
+
+// =================================================================================================
+// 2. The Settings
+// =================================================================================================
+
+/**
+ * @brief The values of `animation.type`, in `AnimationType` order.
+ */
+inline constexpr SettingOption kAnimationTypeOptions[] = {
+  {"linear", "settings.animation_type_options.Linear"},
+  {"live", "settings.animation_type_options.Live"},
+  {"spring", "settings.animation_type_options.Spring"},
+  {"timeline", "settings.animation_type_options.Timeline"},
+};
+static_assert(sizeof(kAnimationTypeOptions) / sizeof(kAnimationTypeOptions[0]) == static_cast<size_t>(AnimationType::Count),
+              "Every AnimationType needs an option");
+
+/**
+ * @brief The default of `animation.timeline`: the "lean, pause, look up, settle" peek of
+ * `MakeDefaultPeekTimeline`. HeadlessBench parses it and fails if the two differ.
+ */
+inline constexpr const char kDefaultTimelineJson[] =
+    "{ \"x\": [{ \"t\": 0.45, \"amount\": 0.9, \"ease\": \"in_out\" }, { \"t\": 0.6, \"amount\": 0.9, \"ease\": \"linear\" }, { \"t\": 1.0, \"ease\": \"in_out\" }], "
+    "\"y\": [{ \"t\": 0.45, \"amount\": 0.5, \"offset\": 0.12, \"ease\": \"out\" }, { \"t\": 0.6, \"amount\": 0.6, \"offset\": 0.12, \"ease\": \"linear\" }, { \"t\": 1.0, \"ease\": \"in_out\" }], "
+    "\"z\": [{ \"t\": 0.45, \"amount\": 0.9, \"ease\": \"in_out\" }, { \"t\": 0.6, \"amount\": 0.9, \"ease\": \"linear\" }, { \"t\": 1.0, \"ease\": \"in_out\" }], "
+    "\"yaw\": [{ \"t\": 0.45, \"amount\": 0.8, \"ease\": \"in_out\" }, { \"t\": 0.6, \"amount\": 0.85, \"ease\": \"linear\" }, { \"t\": 1.0, \"ease\": \"in_out\" }], "
+    "\"pitch\": [{ \"t\": 0.6, \"amount\": 0.0, \"ease\": \"linear\" }, { \"t\": 0.9, \"amount\": 1.08, \"ease\": \"out\" }, { \"t\": 1.0, \"ease\": \"in_out\" }], "
+    "\"fov\": [{ \"t\": 1.0, \"ease\": \"linear\" }] }";
+
+/**
+ * @brief One entry per `SettingKey`, in enum order. Settings of the same group must be neighbours.
+ */
+inline constexpr SettingSchema kSettingSchema[] = {
+  // The default front pose is the front entry of kDefaultPeekPresets.
+  SliderSetting(SettingKey::TargetPosX, "settings.target_camera.position.x", SettingType::Float,
+                PresetPoseOffset(kPeekPresetFront) + PoseChannelOffset(kPosX), kDefaultPeekPresets.poses[kPeekPresetFront].pos[0], -5.0, 5.0, "%.3f"),
+  SliderSetting(SettingKey::TargetPosY, "settings.target_camera.position.y", SettingType::Float,
+                PresetPoseOffset(kPeekPresetFront) + PoseChannelOffset(kPosY), kDefaultPeekPresets.poses[kPeekPresetFront].pos[1], -5.0, 5.0, "%.3f"),
+  SliderSetting(SettingKey::TargetPosZ, "settings.target_camera.position.z", SettingType::Float,
+                PresetPoseOffset(kPeekPresetFront) + PoseChannelOffset(kPosZ), kDefaultPeekPresets.poses[kPeekPresetFront].pos[2], -5.0, 5.0, "%.3f"),
+  SliderSetting(SettingKey::TargetYaw, "settings.target_camera.rotation.yaw", SettingType::Float,
+                PresetPoseOffset(kPeekPresetFront) + PoseChannelOffset(kYaw), kDefaultPeekPresets.poses[kPeekPresetFront].rot[0], -3.1415, 3.1415, "%.3f"),
+  SliderSetting(SettingKey::TargetPitch, "settings.target_camera.rotation.pitch", SettingType::Float,
+                PresetPoseOffset(kPeekPresetFront) + PoseChannelOffset(kPitch), kDefaultPeekPresets.poses[kPeekPresetFront].rot[1], -1.571, 1.571, "%.3f"),
+  SliderSetting(SettingKey::TargetFov, "settings.target_camera.fov", SettingType::Float,
+                PresetPoseOffset(kPeekPresetFront) + PoseChannelOffset(kFov), kDefaultPeekPresets.poses[kPeekPresetFront].fov, 30.0, 120.0, "%.1f"),
+  SliderSetting(SettingKey::AnimationSpeed, "settings.animation.speed", SettingType::Float,
+                offsetof(SettingsSnapshot, animation_speed), 1.1, 0.1, 3.0, "%.1f"),
+  ComboSetting(SettingKey::AnimationType, "settings.animation.type",
+               offsetof(SettingsSnapshot, animation_type), static_cast<uint8_t>(AnimationType::Live), kAnimationTypeOptions),
+  SliderSetting(SettingKey::AnimationMaxStep, "settings.animation.max_step_ms", SettingType::Double,
+                offsetof(SettingsSnapshot, clock.max_step), 50.0, 0.0, 250.0, "%.0f", 1e-3),
+  SliderSetting(SettingKey::SpringStiffness, "settings.animation.spring_stiffness", SettingType::Float,
+                offsetof(SettingsSnapshot, spring_stiffness), 100.0, 10.0, 400.0, "%.0f"),
+  JsonSetting(SettingKey::AnimationTimeline, "settings.animation.timeline", kDefaultTimelineJson),
+  CheckboxSetting(SettingKey::AnimationShortestRotation, "settings.animation.shortest_rotation",
+                  offsetof(SettingsSnapshot, shortest_rotation), true),
+  SliderSetting(SettingKey::HoldSmoothing, "settings.hold.smoothing_ms", SettingType::Float,
+                offsetof(SettingsSnapshot, hold_filter.smoothing_time), 50.0, 0.0, 500.0, "%.0f", 1e-3),
+  SliderSetting(SettingKey::HoldDeadband, "settings.hold.deadband", SettingType::Float,
+                offsetof(SettingsSnapshot, hold_filter.deadband), 0.01, 0.0, 0.1, "%.3f"),
+  CheckboxSetting(SettingKey::AutoPeekEnabled, "settings.auto_peek.enabled",
+                  offsetof(SettingsSnapshot, auto_peek.enabled), false),
+  SliderSetting(SettingKey::AutoPeekDwell, "settings.auto_peek.dwell_ms", SettingType::Float,
+                offsetof(SettingsSnapshot, auto_peek.dwell_time), 1500.0, 0.0, 5000.0, "%.0f", 1e-3),
+  // Shown in km/h, compared with the telemetry speed in m/s.
+  SliderSetting(SettingKey::AutoPeekStopSpeed, "settings.auto_peek.stop_speed_kmh", SettingType::Float,
+                offsetof(SettingsSnapshot, auto_peek.stop_speed), 2.0, 0.5, 10.0, "%.1f", 1.0 / 3.6),
+  SliderSetting(SettingKey::AutoPeekResumeSpeed, "settings.auto_peek.resume_speed_kmh", SettingType::Float,
+                offsetof(SettingsSnapshot, auto_peek.resume_speed), 5.0, 1.0, 20.0, "%.1f", 1.0 / 3.6),
+  CheckboxSetting(SettingKey::StabilizationEnabled, "settings.stabilization.enabled",
+                  offsetof(SettingsSnapshot, stabilization.enabled), false),
+  SliderSetting(SettingKey::StabilizationStrength, "settings.stabilization.strength", SettingType::Float,
+                offsetof(SettingsSnapshot, stabilization.strength), 1.0, 0.0, 1.0, "%.2f"),
+  SliderSetting(SettingKey::StabilizationMinCutoff, "settings.stabilization.min_cutoff_hz", SettingType::Float,
+                offsetof(SettingsSnapshot, stabilization.min_cutoff), 0.3, 0.05, 3.0, "%.2f"),
+  SliderSetting(SettingKey::StabilizationBeta, "settings.stabilization.beta", SettingType::Float,
+                offsetof(SettingsSnapshot, stabilization.beta), 0.5, 0.0, 5.0, "%.2f"),
+  // The smallest camera change that is worth a Cam_Set* call
+  SliderSetting(SettingKey::OutputWriteEpsilon, "settings.output.write_epsilon", SettingType::Float,
+                offsetof(SettingsSnapshot, write_epsilon), 0.0001, 0.0, 0.01, "%.5f"),
+  CheckboxSetting(SettingKey::TraceSessions, "settings.diagnostics.trace_sessions",
+                  offsetof(SettingsSnapshot, trace_sessions), false),
+  PoseSetting(SettingKey::PresetLeftPillar, "settings.presets.left_pillar",
+              PresetPoseOffset(kPeekPresetLeftPillar), kDefaultPeekPresets.poses[kPeekPresetLeftPillar]),
+  PoseSetting(SettingKey::PresetRightPillar, "settings.presets.right_pillar",
+              PresetPoseOffset(kPeekPresetRightPillar), kDefaultPeekPresets.poses[kPeekPresetRightPillar]),
+  PoseSetting(SettingKey::PresetKerb, "settings.presets.kerb",
+              PresetPoseOffset(kPeekPresetKerb), kDefaultPeekPresets.poses[kPeekPresetKerb]),
+  // Written by the plugin itself (see ReadJsonTruckProfiles); edited through the target_camera sliders.
+  JsonSetting(SettingKey::TruckProfiles, "settings.truck_profiles", "[]"),
+};
+static_assert(sizeof(kSettingSchema) / sizeof(kSettingSchema[0]) == static_cast<size_t>(SettingKey::Count),
+              "Every SettingKey needs a schema entry");
+static_assert([] {
+  for (int key = 0; key < static_cast<int>(SettingKey::Count); ++key) {
+    if (kSettingSchema[key].key != static_cast<SettingKey>(key))
+      return false;
+  }
+  return true;
+}(), "kSettingSchema follows the SettingKey order");
+
+/**
+ * @brief The schema entry of a setting.
+ */
+constexpr const SettingSchema& GetSettingSchema(SettingKey key) {
+  return kSettingSchema[static_cast<int>(key)];
+}
+
+/**
+ * @brief Returns the config path of a setting.
+ */
+constexpr const char* SettingPath(SettingKey key) {
+  return GetSettingSchema(key).path;
+}
+
+/**
+ * @brief The full config path (`settings.` included) of every `SettingKey`, in enum order.
+ */
+inline constexpr auto kSettingPaths = [] {
+  std::array<const char*, static_cast<size_t>(SettingKey::Count)> paths{};
+  for (size_t key = 0; key < paths.size(); ++key)
+    paths[key] = kSettingSchema[key].path;
+  return paths;
+}();
+
+// =================================================================================================
+// 3. Loading
+// =================================================================================================
+
+/**
+ * @brief The field of `snapshot` that `schema` describes; `T` must be the field's type.
+ */
+template <typename T>
+T& SettingField(SettingsSnapshot& snapshot, const SettingSchema& schema) {
+  return *reinterpret_cast<T*>(reinterpret_cast<unsigned char*>(&snapshot) + schema.offset);
+}
+
+/**
+ * @brief Stores a `Float`, `Double`, `Bool` or `Choice` value, given as shown to the user.
+ * @details Converts with `scale`; keeps a setting whose range starts at 0 from going negative and
+ * an option index within the options. Other types are left alone.
+ */
+void StoreSettingValue(SettingsSnapshot& snapshot, const SettingSchema& schema, double shown);
+
+/**
+ * @brief Stores the default of every `Float`, `Double`, `Bool` and `Choice` setting.
+ * @details Poses and other JSON values are left alone.
+ */
+void ApplySettingDefaults(SettingsSnapshot& snapshot);
+
+/**
+ * @brief The index of the option of a `Choice` setting with the given value, or -1.
+ */
+int FindSettingOption(const SettingSchema& schema, const char* value);
+
+// =================================================================================================
+// 4. Generated Manifest Text
+// =================================================================================================
+
+/**
+ * @brief Writes text of unknown length at compile time: counts it (`TextSizer`), then writes it
+ * into a buffer of the counted size (`TextBuffer`).
+ */
+struct TextSizer {
+  size_t size = 0;
+  constexpr void Put(char) { ++size; }
+  constexpr void Put(const char* text) {
+    while (*text++)
+      ++size;
+  }
+};
+
+template <size_t N>
+struct TextBuffer {
+  char text[N] = {};
+  size_t size = 0;
+  constexpr void Put(char c) { text[size++] = c; }
+  constexpr void Put(const char* text_to_add) {
+    for (; *text_to_add; ++text_to_add)
+      text[size++] = *text_to_add;
+  }
+};
+
+/**
+ * @brief Writes a number with up to six decimals, always with a decimal point (`80.0`, `-0.06`).
+ */
+template <typename Out>
+constexpr void PutSettingNumber(Out& out, double value) {
+  if (value < 0.0) {
+    out.Put('-');
+    value = -value;
+  }
+  uint64_t micros = static_cast<uint64_t>(value * 1e6 + 0.5);
+  uint64_t whole = micros / 1000000;
+  uint64_t fraction = micros % 1000000;
+
+  char digits[20] = {};
+  int count = 0;
+  do {
+    digits[count++] = static_cast<char>('0' + whole % 10);
+    whole /= 10;
+  } while (whole != 0);
+  while (count > 0)
+    out.Put(digits[--count]);
+
+  out.Put('.');
+  if (fraction == 0) {
+    out.Put('0');
+    return;
+  }
+  int width = 6;
+  while (fraction % 10 == 0) {
+    fraction /= 10;
+    --width;
+  }
+  for (int i = width - 1; i >= 0; --i) {
+    digits[i] = static_cast<char>('0' + fraction % 10);
+    fraction /= 10;
+  }
+  for (int i = 0; i < width; ++i)
+    out.Put(digits[i]);
+}
+
+/**
+ * @brief The number of groups of a path without `settings.` (the dots in it).
+ */
+constexpr int SettingGroupDepth(const char* path) {
+  int depth = 0;
+  for (; *path; ++path)
+    depth += *path == '.';
+  return depth;
+}
+
+/**
+ * @brief The number of leading groups two paths without `settings.` have in common.
+ */
+constexpr int SettingCommonGroups(const char* a, const char* b) {
+  int common = 0;
+  for (; *a && *a == *b; ++a, ++b)
+    common += *a == '.';
+  return common;
+}
+
+/**
+ * @brief Writes segment `index` of a dotted path, in quotes.
+ */
+template <typename Out>
+constexpr void PutSettingSegment(Out& out, const char* path, int index) {
+  for (; index > 0; ++path)
+    index -= *path == '.';
+  out.Put('"');
+  for (; *path && *path != '.'; ++path)
+    out.Put(*path);
+  out.Put('"');
+}
+
+/**
+ * @brief `true` if the settings of every group are neighbours in `kSettingSchema`, so the
+ * defaults JSON can open and close each group once.
+ */
+constexpr bool SettingGroupsAreContiguous() {
+  constexpr int kPrefix = 9; // "settings."
+  constexpr int kCount = static_cast<int>(SettingKey::Count);
+  for (int i = 0; i < kCount; ++i) {
+    for (int j = 0; j + 1 < i; ++j) {
+      int common = SettingCommonGroups(kSettingSchema[i].path + kPrefix, kSettingSchema[j].path + kPrefix);
+      for (int between = j + 1; between < i; ++between) {
+        if (SettingCommonGroups(kSettingSchema[between].path + kPrefix, kSettingSchema[i].path + kPrefix) < common)
+          return false;
+      }
+    }
+  }
+  return true;
+}
+static_assert(SettingGroupsAreContiguous(), "Keep the settings of a group together in kSettingSchema");
+
+/**
+ * @brief Where `WriteSettingsManifestText` put the metadata strings of every setting.
+ */
+struct SettingMetaOffsets {
+  static constexpr uint32_t kNone = ~0u;
+
+  uint32_t title[static_cast<int>(SettingKey::Count)] = {};
+  uint32_t desc[static_cast<int>(SettingKey::Count)] = {};
+  uint32_t params[static_cast<int>(SettingKey::Count)] = {};
+};
+
+/**
+ * @brief Writes the defaults JSON (at offset 0) and then every metadata string, each terminated
+ * by a NUL.
+ */
+template <typename Out>
+constexpr void WriteSettingsManifestText(Out& out, SettingMetaOffsets& offsets) {
+  constexpr int kPrefix = 9; // "settings."
+  constexpr int kCount = static_cast<int>(SettingKey::Count);
+
+  // --- Defaults: the groups are opened and closed while walking the table ---
+  out.Put('{');
+  int open = 0;
+  for (int i = 0; i < kCount; ++i) {
+    const SettingSchema& schema = kSettingSchema[i];
+    const char* path = schema.path + kPrefix;
+    int common = i == 0 ? 0 : SettingCommonGroups(kSettingSchema[i - 1].path + kPrefix, path);
+    for (; open > common; --open)
+      out.Put(" }");
+    out.Put(i == 0 ? " " : ", ");
+    for (int depth = SettingGroupDepth(path); open < depth; ++open) {
+      PutSettingSegment(out, path, open);
+      out.Put(": { ");
+    }
+    PutSettingSegment(out, path, open);
+    out.Put(": ");
+
+    switch (schema.type) {
+      case SettingType::Float:
+      case SettingType::Double:
+        PutSettingNumber(out, schema.default_value);
+        break;
+      case SettingType::Bool:
+        out.Put(schema.default_value != 0.0 ? "true" : "false");
+        break;
+      case SettingType::Choice:
+        out.Put('"');
+        out.Put(schema.options[static_cast<int>(schema.default_value)].value);
+        out.Put('"');
+        break;
+      case SettingType::Pose: {
+        const CameraPose& pose = *schema.default_pose;
+        const float values[] = {pose.pos[0], pose.pos[1], pose.pos[2], pose.rot[0], pose.rot[1], pose.fov};
+        out.Put('[');
+        for (int v = 0; v < 6; ++v) {
+          out.Put(v == 0 ? "" : ", ");
+          PutSettingNumber(out, values[v]);
+        }
+        out.Put(']');
+        break;
+      }
+      case SettingType::Json:
+      default:
+        out.Put(schema.default_json);
+        break;
+    }
+  }
+  for (; open > 0; --open)
+    out.Put(" }");
+  out.Put(" }");
+  out.Put('\0');
+
+  // --- Metadata: "<path>.title", "<path>.desc" and the widget parameters ---
+  for (int i = 0; i < kCount; ++i) {
+    const SettingSchema& schema = kSettingSchema[i];
+    offsets.title[i] = static_cast<uint32_t>(out.size);
+    out.Put(schema.path);
+    out.Put(".title");
+    out.Put('\0');
+    offsets.desc[i] = static_cast<uint32_t>(out.size);
+    out.Put(schema.path);
+    out.Put(".desc");
+    out.Put('\0');
+
+    offsets.params[i] = SettingMetaOffsets::kNone;
+    if (schema.widget == SettingWidget::Slider) {
+      offsets.params[i] = static_cast<uint32_t>(out.size);
+      out.Put("{ \"min\": ");
+      PutSettingNumber(out, schema.min);
+      out.Put(", \"max\": ");
+      PutSettingNumber(out, schema.max);
+      out.Put(", \"format\": \"");
+      out.Put(schema.format);
+      out.Put("\" }");
+      out.Put('\0');
+    } else if (schema.widget == SettingWidget::Combo) {
+      offsets.params[i] = static_cast<uint32_t>(out.size);
+      out.Put("{ \"options\": [");
+      for (int o = 0; o < schema.option_count; ++o) {
+        out.Put(o == 0 ? " { \"value\": \"" : ", { \"value\": \"");
+        out.Put(schema.options[o].value);
+        out.Put("\", \"labelKey\": \"");
+        out.Put(schema.options[o].label_key);
+        out.Put("\" }");
+      }
+      out.Put(" ] }");
+      out.Put('\0');
+    }
+  }
+}
+
+inline constexpr size_t kSettingsManifestTextSize = [] {
+  TextSizer sizer;
+  SettingMetaOffsets offsets;
+  WriteSettingsManifestText(sizer, offsets);
+  return sizer.size;
+}();
+
+/**
+ * @brief The generated defaults JSON and metadata strings, with their offsets.
+ */
+struct SettingsManifestText {
+  TextBuffer<kSettingsManifestTextSize> buffer;
+  SettingMetaOffsets offsets;
+};
+
+inline constexpr SettingsManifestText kSettingsManifestText = [] {
+  SettingsManifestText text;
+  WriteSettingsManifestText(text.buffer, text.offsets);
+  return text;
+}();
+
+/**
+ * @brief The manifest's default settings JSON (`Settings_SetJson`).
+ */
+constexpr const char* SettingsDefaultsJson() {
+  return kSettingsManifestText.buffer.text;
+}
+
+/**
+ * @brief The arguments of `Meta_AddCustomSetting` for one setting.
+ */
+struct SettingMeta {
+  const char* key;    // Path without `settings.`
+  const char* title;  // Localization keys
+  const char* desc;
+  const char* widget; // "slider", "combo", or null for a checkbox or a hidden setting
+  const char* params; // Widget parameters as JSON, or null
+  bool hidden;
+};
+
+/**
+ * @brief The metadata of a setting; `false` for settings without their own metadata.
+ */
+constexpr bool GetSettingMeta(SettingKey key, SettingMeta& meta) {
+  const SettingSchema& schema = GetSettingSchema(key);
+  if (schema.widget == SettingWidget::None)
+    return false;
+
+  const char* text = kSettingsManifestText.buffer.text;
+  const SettingMetaOffsets& offsets = kSettingsManifestText.offsets;
+  int index = static_cast<int>(key);
+  meta.key = schema.path + 9;
+  meta.title = text + offsets.title[index];
+  meta.desc = text + offsets.desc[index];
+  meta.widget = schema.widget == SettingWidget::Slider ? "slider" : schema.widget == SettingWidget::Combo ? "combo" : nullptr;
+  meta.params = offsets.params[index] == SettingMetaOffsets::kNone ? nullptr : text + offsets.params[index];
+  meta.hidden = schema.widget == SettingWidget::Hidden;
+  return true;
+}
+
+}  // namespace SPF_FrontalBlindspotViewer
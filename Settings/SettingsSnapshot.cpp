@@ -0,0 +1,52 @@
+/**
+ * @file SettingsSnapshot.cpp
+ * @brief Implementation of the lock-free settings triple buffer.
+ */
+
+#include "SettingsSnapshot.hpp"
+
+namespace SPF_FrontalBlindspotViewer
+{
+
+    bool SettingsChangedSince(const SettingsSnapshot &snapshot, uint64_t keys, uint64_t generation)
+    {
+        for (int key = 0; keys != 0; ++key, keys >>= 1)
+        {
+            if ((keys & 1) != 0 && snapshot.key_generations[key] > generation)
+                return true;
+        }
+        return false;
+    }
+
+    void PublishSettings(SettingsExchange &exchange, uint64_t changed)
+    {
+        uint8_t published = exchange.back;
+        SettingsSnapshot &back = exchange.buffers[published];
+        back.generation = ++exchange.published;
+        for (int key = 0; key < static_cast<int>(SettingKey::Count); ++key)
+        {
+            if ((changed & SettingBit(static_cast<SettingKey>(key))) != 0)
+                back.key_generations[key] = back.generation;
+        }
+
+        // Release: the edits above are visible before the reader can take this buffer.
+        uint8_t previous = exchange.shared.exchange(static_cast<uint8_t>(published | SettingsExchange::kFresh), std::memory_order_acq_rel);
+        exchange.back = previous & SettingsExchange::kIndexMask;
+
+        // The reader only ever reads the published buffer, so the writer may too; the next edits
+        // start from it.
+        exchange.buffers[exchange.back] = back;
+    }
+
+    bool AcquireSettings(SettingsExchange &exchange)
+    {
+        // The common case, nothing new: one load and no write to shared memory.
+        if ((exchange.shared.load(std::memory_order_acquire) & SettingsExchange::kFresh) == 0)
+            return false;
+
+        uint8_t previous = exchange.shared.exchange(exchange.front, std::memory_order_acq_rel);
+        exchange.front = previous & SettingsExchange::kIndexMask;
+        return true;
+    }
+
+} // namespace SPF_FrontalBlindspotViewer
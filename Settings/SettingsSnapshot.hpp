@@ -0,0 +1,121 @@
+/**
+ * @file SettingsSnapshot.hpp
+ * @brief The plugin's settings as one immutable value, handed from the config thread to the frame loop.
+ *
+ * @details `OnSettingChanged` may be called from the framework's UI thread while `OnUpdate` runs on
+ * the render thread. The settings the frame loop reads are therefore never edited: they are handed
+ * over through a `SettingsExchange`, a lock-free triple buffer. The writer edits its back buffer in
+ * place (`StagedSettings`) and publishes it by swapping its index into the shared slot; the frame
+ * loop checks that slot with a single acquire load per frame, swaps it into its front buffer only
+ * when something new was published, and reads the front buffer where it is. Neither side ever
+ * blocks or sees a half-written snapshot.
+ *
+ * The writer's new back buffer is then brought up to date from the one it just published (one
+ * copy, on the writer's thread), so its next edit starts from every value published so far. Each
+ * snapshot records the generation in which every setting was last loaded, so the frame loop can
+ * tell what changed without keeping a copy of the previous snapshot.
+ *
+ * There may be one writer thread and one reader thread at a time.
+ */
+#pragma once
+
+#include <atomic>  // For std::atomic
+#include <cstdint> // For uint8_t, uint64_t
+
+#include "AnalogFilter.hpp"     // For AnalogFilterSettings
+#include "AnimationClock.hpp"   // For AnimationClockSettings
+#include "AnimationKernels.hpp" // For AnimationType and CameraPose
+#include "AutoPeek.hpp"         // For AutoPeekSettings
+#include "CabinStabilizer.hpp"  // For CabinStabilizerSettings
+#include "PeekPresets.hpp"      // For PeekPresetTable
+#include "PeekTimeline.hpp"     // For PeekTimeline
+#include "SettingKeys.hpp"      // For SettingKey
+
+namespace SPF_FrontalBlindspotViewer {
+
+// =================================================================================================
+// 1. Snapshot
+// =================================================================================================
+
+/**
+ * @brief Every value the plugin reads from its config, as of one publication.
+ */
+struct SettingsSnapshot {
+  PeekPresetTable presets = kDefaultPeekPresets; // `presets.*`; the front pose is the `target_camera` sliders
+  float animation_speed = 0.0f;
+  AnimationType animation_type = AnimationType::Live;
+  float spring_stiffness = 100.0f;
+  PeekTimeline timeline = MakeDefaultPeekTimeline(); // `animation.timeline`, for AnimationType::Timeline
+  bool shortest_rotation = true;   // `animation.shortest_rotation`
+  AnimationClockSettings clock;    // `animation.max_step_ms`
+  AnalogFilterSettings hold_filter; // `hold.*`; `max_rate` follows `animation_speed`
+  AutoPeekSettings auto_peek;      // `auto_peek.*`
+  CabinStabilizerSettings stabilization; // `stabilization.*`
+  float write_epsilon = 1e-4f;     // `output.write_epsilon`
+  bool trace_sessions = false;     // `diagnostics.trace_sessions`
+  uint64_t generation = 0;         // Set by `PublishSettings`, 1 for the first publication
+  uint64_t key_generations[static_cast<int>(SettingKey::Count)] = {}; // Publication in which each setting last changed
+};
+
+/**
+ * @brief The bit of `key` in a set of settings passed to `PublishSettings`.
+ */
+constexpr uint64_t SettingBit(SettingKey key) {
+  return 1ull << static_cast<int>(key);
+}
+static_assert(static_cast<int>(SettingKey::Count) <= 64, "A set of settings no longer fits a uint64_t");
+
+inline constexpr uint64_t kAllSettings = (1ull << static_cast<int>(SettingKey::Count)) - 1;
+
+/**
+ * @brief `true` if any of `keys` (`SettingBit`s) changed in a publication after `generation`.
+ */
+bool SettingsChangedSince(const SettingsSnapshot& snapshot, uint64_t keys, uint64_t generation);
+
+// =================================================================================================
+// 2. Exchange
+// =================================================================================================
+
+/**
+ * @brief A single-writer, single-reader triple buffer of `SettingsSnapshot`s.
+ */
+struct SettingsExchange {
+  static constexpr uint8_t kIndexMask = 0x3;
+  static constexpr uint8_t kFresh = 0x4; // The shared buffer holds a snapshot the reader has not taken
+
+  SettingsSnapshot buffers[3];
+  std::atomic<uint8_t> shared{1}; // Buffer index, plus `kFresh`
+  uint8_t back = 0;               // Owned by the writer
+  uint8_t front = 2;              // Owned by the reader
+  uint64_t published = 0;         // Owned by the writer
+};
+
+/**
+ * @brief Writer side: the snapshot being prepared, edited in place until `PublishSettings`.
+ * @details Holds everything published so far plus the edits since.
+ */
+inline SettingsSnapshot& StagedSettings(SettingsExchange& exchange) {
+  return exchange.buffers[exchange.back];
+}
+
+/**
+ * @brief Writer side: publishes `StagedSettings` by index (its `generation` is assigned here).
+ * @param changed The settings edited since the last publication (`SettingBit`s).
+ */
+void PublishSettings(SettingsExchange& exchange, uint64_t changed);
+
+/**
+ * @brief Reader side: takes the latest published snapshot, if there is a new one.
+ * @return `true` if `CurrentSettings` changed.
+ */
+bool AcquireSettings(SettingsExchange& exchange);
+
+/**
+ * @brief Reader side: the snapshot taken by the last successful `AcquireSettings`.
+ * @details Stays valid and unchanged until the next `AcquireSettings` on the same thread.
+ */
+inline const SettingsSnapshot& CurrentSettings(const SettingsExchange& exchange) {
+  return exchange.buffers[exchange.front];
+}
+
+}  // namespace SPF_FrontalBlindspotViewer
@@ -0,0 +1,134 @@
+/**
+ * @file AnimationKernelBench.cpp
+ * @brief Per-frame cost of the animation type dispatch, before and after the kernel selection.
+ *
+ * @details "before" reproduces the previous frame loop: a `std::string` compare against "live"
+ * on every animated frame followed by a branch into the curve code. "after" is the
+ * `AnimationKernel` function pointer picked once by `SelectAnimationKernel`. The settings
+ * reload cost (reassigning the `std::string` versus parsing into the enum) is reported too.
+ *
+ * The "spring" curve is checked for monotonic motion (no overshoot) and exact end points on every
+ * channel; the executable returns 1 if it fails.
+ */
+#include "AnimationKernels.hpp"
+#include "BenchUtils.hpp"
+
+#include <cmath>   // For std::fabs
+#include <cstdio>  // For std::printf
+#include <string>  // For std::string
+
+using namespace SPF_FrontalBlindspotViewer;
+using namespace SPF_FrontalBlindspotViewer::Bench;
+
+namespace {
+
+AnimationTrack MakeTrack(AnimationType type) {
+  AnimationTrack track;
+  track.start.pos[0] = 0.0f;  track.end.pos[0] = -0.06f;
+  track.start.pos[1] = 0.0f;  track.end.pos[1] = -0.10f;
+  track.start.pos[2] = 0.0f;  track.end.pos[2] = -0.88f;
+  track.start.rot[0] = 0.0f;  track.end.rot[0] = -0.03f;
+  track.start.rot[1] = 0.0f;  track.end.rot[1] = 0.58f;
+  track.start.fov = 65.0f;    track.end.fov = 80.0f;
+  track.towardsTarget = true;
+  SelectAnimationKernel(type).Prepare(track);
+  return track;
+}
+
+// The frame body as it was before: a string compare selects the curve every frame.
+void EvaluateByString(const std::string& animation_type, const AnimationTrack& track, float p, CameraPose& out) {
+  if (animation_type == "live") {
+    LiveCurve::Evaluate(track, p, out);
+  } else if (animation_type == "spring") {
+    SpringCurve::Evaluate(track, p, out);
+  } else {
+    LinearCurve::Evaluate(track, p, out);
+  }
+}
+
+void RunDispatch(AnimationType type, const char* label) {
+  constexpr uint64_t kFrames = 5'000'000;
+  constexpr float kStep = 1.0f / 4096.0f;
+
+  AnimationTrack track = MakeTrack(type);
+  // Built at runtime, like the value LoadSettings copied out of the config.
+  std::string animation_type(AnimationTypeName(type));
+  const AnimationKernel* kernel = &SelectAnimationKernel(type);
+  CameraPose pose;
+
+  std::printf("Dispatch, animation.type = \"%s\"\n", label);
+  double before = MeasureNsPerOp(kFrames, [&](uint64_t i) {
+    EvaluateByString(animation_type, track, static_cast<float>(i & 4095) * kStep, pose);
+    DoNotOptimize(pose);
+  });
+  double after = MeasureNsPerOp(kFrames, [&](uint64_t i) {
+    kernel->Evaluate(track, static_cast<float>(i & 4095) * kStep, pose);
+    DoNotOptimize(pose);
+  });
+  PrintResult("before: std::string compare + branch", before);
+  PrintResult("after: kernel function pointer", after);
+}
+
+float Channel(const CameraPose& pose, int c) {
+  return c < 3 ? pose.pos[c] : (c < 5 ? pose.rot[c - 3] : pose.fov);
+}
+
+// The spring must move every channel monotonically from start to end and land exactly on both.
+bool CheckSpring() {
+  AnimationTrack track = MakeTrack(AnimationType::Spring);
+  const AnimationKernel& kernel = SelectAnimationKernel(AnimationType::Spring);
+
+  bool ok = true;
+  CameraPose previous, pose;
+  kernel.Evaluate(track, 0.0f, previous);
+  for (int c = 0; c < kPoseChannelCount; ++c) {
+    ok = ok && std::fabs(Channel(previous, c) - Channel(track.start, c)) < 1e-6f;
+  }
+  for (int i = 1; i <= 4096; ++i) {
+    kernel.Evaluate(track, static_cast<float>(i) / 4096.0f, pose);
+    for (int c = 0; c < kPoseChannelCount; ++c) {
+      float direction = Channel(track.end, c) - Channel(track.start, c);
+      ok = ok && (Channel(pose, c) - Channel(previous, c)) * direction >= 0.0f;
+    }
+    previous = pose;
+  }
+  for (int c = 0; c < kPoseChannelCount; ++c) {
+    ok = ok && std::fabs(Channel(pose, c) - Channel(track.end, c)) < 1e-5f;
+  }
+
+  std::printf("Spring: duration %.3f s at stiffness %.0f, monotonic with exact end points: %s\n",
+              track.duration, track.stiffness, ok ? "yes" : "NO");
+  return ok;
+}
+
+}  // namespace
+
+int main() {
+  RunDispatch(AnimationType::Live, "live");
+  RunDispatch(AnimationType::Linear, "linear");
+  RunDispatch(AnimationType::Spring, "spring");
+  bool spring_ok = CheckSpring();
+
+  // --- Settings reload ---
+  constexpr uint64_t kReloads = 2'000'000;
+  const char* values[2] = { "linear", "live" };
+  std::string as_string = "live";
+  AnimationType as_enum = AnimationType::Live;
+
+  std::printf("Settings reload of animation.type\n");
+  double before = MeasureNsPerOp(kReloads, [&](uint64_t i) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%s", values[i & 1]);
+    as_string = buffer;
+    DoNotOptimize(as_string);
+  });
+  double after = MeasureNsPerOp(kReloads, [&](uint64_t i) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%s", values[i & 1]);
+    as_enum = ParseAnimationType(buffer, as_enum);
+    DoNotOptimize(as_enum);
+  });
+  PrintResult("before: std::string assignment", before);
+  PrintResult("after: parse into AnimationType", after);
+  return spring_ok ? 0 : 1;
+}
@@ -0,0 +1,141 @@
+/**
+ * @file ArcLengthBench.cpp
+ * @brief Accuracy and cost of the arc-length reparameterization of the "live" seat arc.
+ *
+ * @details For random peeks drawn from the settings slider ranges, measures how far the distance
+ * travelled along the arc strays from the requested one, against a finely sampled reference, and
+ * how much the seat speed varies along the arc (with a linear easing) with and without the table.
+ * Then times the table build paid once per trigger (inside `MakeLivePath`) and one lookup. The
+ * executable returns 1 if the distance error exceeds its bound.
+ */
+#include "BenchUtils.hpp"
+#include "PeekPath.hpp"
+
+#include <cmath>   // For std::sqrt, std::fabs
+#include <cstdio>  // For std::printf
+#include <random>  // For std::mt19937
+
+using namespace SPF_FrontalBlindspotViewer;
+using namespace SPF_FrontalBlindspotViewer::Bench;
+
+namespace {
+
+constexpr float kMaxDistanceError = 1e-3f; // Of the arc length, see ArcLengthTable
+constexpr int kReferenceSteps = 4096;
+
+CameraPose RandomPose(std::mt19937& rng) {
+  // Same ranges as the slider metadata in BuildManifest.
+  std::uniform_real_distribution<float> position(-5.0f, 5.0f);
+  CameraPose pose;
+  pose.pos[0] = position(rng);
+  pose.pos[1] = position(rng);
+  pose.pos[2] = position(rng);
+  return pose;
+}
+
+void ArcPoint(const LivePath& path, float t, float (&out)[3]) {
+  for (int axis = 0; axis < 3; ++axis)
+    out[axis] = QuadraticBezier(t, path.start.pos[axis], path.control[axis], path.end.pos[axis]);
+}
+
+float Distance(const float (&a)[3], const float (&b)[3]) {
+  float dx = b[0] - a[0], dy = b[1] - a[1], dz = b[2] - a[2];
+  return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+// Cumulative length of the arc at kReferenceSteps + 1 evenly spaced parameters, normalized.
+void ReferenceLengths(const LivePath& path, double (&out)[kReferenceSteps + 1]) {
+  float previous[3], point[3];
+  ArcPoint(path, 0.0f, previous);
+  out[0] = 0.0;
+  for (int i = 1; i <= kReferenceSteps; ++i) {
+    ArcPoint(path, static_cast<float>(i) / kReferenceSteps, point);
+    out[i] = out[i - 1] + Distance(previous, point);
+    for (int axis = 0; axis < 3; ++axis) previous[axis] = point[axis];
+  }
+  for (double& length : out) length /= out[kReferenceSteps];
+}
+
+// Travelled fraction at parameter t, interpolated from the reference lengths.
+double ReferenceDistance(const double (&lengths)[kReferenceSteps + 1], float t) {
+  double x = static_cast<double>(t) * kReferenceSteps;
+  int i = static_cast<int>(x);
+  if (i >= kReferenceSteps) return 1.0;
+  return lengths[i] + (lengths[i + 1] - lengths[i]) * (x - i);
+}
+
+// Fastest over slowest seat speed over 64 equal steps of the mapping from progress to parameter.
+template <typename Map>
+float SpeedRatio(const LivePath& path, Map&& map) {
+  constexpr int kSteps = 64;
+  float slowest = 1e30f, fastest = 0.0f;
+  float previous[3], point[3];
+  ArcPoint(path, map(0.0f), previous);
+  for (int i = 1; i <= kSteps; ++i) {
+    ArcPoint(path, map(static_cast<float>(i) / kSteps), point);
+    float step = Distance(previous, point);
+    slowest = std::fmin(slowest, step);
+    fastest = std::fmax(fastest, step);
+    for (int axis = 0; axis < 3; ++axis) previous[axis] = point[axis];
+  }
+  return fastest / std::fmax(slowest, 1e-9f);
+}
+
+}  // namespace
+
+int main() {
+  std::mt19937 rng(4321);
+
+  // --- Accuracy and speed variation ---
+  static double lengths[kReferenceSteps + 1];
+  double worst_error = 0.0;
+  float worst_raw_ratio = 0.0f, worst_arc_ratio = 0.0f;
+  for (int trial = 0; trial < 2000; ++trial) {
+    LivePath path = MakeLivePath(RandomPose(rng), RandomPose(rng), (trial & 1) == 0);
+    ReferenceLengths(path, lengths);
+
+    for (int step = 0; step <= 1000; ++step) {
+      float s = static_cast<float>(step) / 1000.0f;
+      double error = std::fabs(ReferenceDistance(lengths, ParameterAtDistance(path.arc, s)) - s);
+      if (error > worst_error) worst_error = error;
+    }
+    worst_raw_ratio = std::fmax(worst_raw_ratio, SpeedRatio(path, [](float p) { return p; }));
+    worst_arc_ratio = std::fmax(worst_arc_ratio, SpeedRatio(path, [&](float p) { return ParameterAtDistance(path.arc, p); }));
+  }
+
+  std::printf("Arc-length table (%d segments, 2000 random peeks, slider ranges)\n", ArcLengthTable::kSegments);
+  std::printf("  max |distance error| / arc length %22.6f (bound %.6f)\n", worst_error, kMaxDistanceError);
+  std::printf("  fastest / slowest seat speed, Bezier parameter %9.2f\n", worst_raw_ratio);
+  std::printf("  fastest / slowest seat speed, arc length %15.2f\n", worst_arc_ratio);
+
+  // --- Cost ---
+  CameraPose seat = RandomPose(rng);
+  CameraPose target = RandomPose(rng);
+  LivePath path = MakeLivePath(seat, target, true);
+  float points[ArcLengthTable::kSamples][3];
+  for (int i = 0; i < ArcLengthTable::kSamples; ++i)
+    ArcPoint(path, static_cast<float>(i) / ArcLengthTable::kSegments, points[i]);
+
+  ArcLengthTable table;
+  double build = MeasureNsPerOp(2'000'000, [&](uint64_t i) {
+    points[0][0] = static_cast<float>(i & 1) * 1e-3f; // Keep the build from being hoisted
+    BuildArcLengthTable(points, table);
+    DoNotOptimize(table);
+  });
+  float t = 0.0f;
+  double lookup = MeasureNsPerOp(20'000'000, [&](uint64_t i) {
+    t = ParameterAtDistance(path.arc, static_cast<float>(i & 4095) * (1.0f / 4096.0f));
+    DoNotOptimize(t);
+  });
+  double make = MeasureNsPerOp(2'000'000, [&](uint64_t i) {
+    seat.pos[0] = static_cast<float>(i & 1) * 1e-3f;
+    LivePath made = MakeLivePath(seat, target, true);
+    DoNotOptimize(made);
+  });
+  std::printf("Cost\n");
+  PrintResult("build the table (once per trigger)", build);
+  PrintResult("MakeLivePath, table included", make);
+  PrintResult("distance -> parameter lookup", lookup);
+
+  return worst_error <= kMaxDistanceError ? 0 : 1;
+}
@@ -0,0 +1,156 @@
+/**
+ * @file AutoPeekBench.cpp
+ * @brief Behaviour and cost of the automatic peek's stop detector.
+ *
+ * @details Plays a scripted drive at 60 Hz through `AutoPeekDetector`: braking to a stop line,
+ * waiting, releasing the brake, pulling away, a throttle blip at a second stop, and a minute of
+ * creeping in a queue. The creeping part is also run through a naive detector (one speed
+ * threshold, no dwell time) to show how often it would toggle the camera. Then times what the
+ * truck data callback pays (pack and store one word) and what the frame loop pays per frame. The
+ * executable returns 1 if the detector peeks or returns at the wrong moment.
+ */
+#include "AutoPeek.hpp"
+#include "BenchUtils.hpp"
+
+#include <atomic> // For std::atomic
+#include <cmath>  // For std::sin
+#include <cstdio> // For std::printf
+
+using namespace SPF_FrontalBlindspotViewer;
+using namespace SPF_FrontalBlindspotViewer::Bench;
+
+namespace {
+
+constexpr double kDt = 1.0 / 60.0;
+
+int g_failures = 0;
+
+void Check(bool ok, const char* what) {
+  if (!ok) {
+    std::printf("FAILED: %s\n", what);
+    ++g_failures;
+  }
+}
+
+struct Drive {
+  AutoPeekDetector detector;
+  AutoPeekSettings settings;
+  double now = 0.0;
+  int peeks = 0;
+  int returns = 0;
+  double last_peek = 0.0;
+
+  // Runs `seconds` of frames with the sample produced by `script(t)` (t from the phase start).
+  template <typename Script>
+  void Run(double seconds, Script&& script) {
+    double start = now;
+    for (; now - start < seconds; now += kDt) {
+      // Through the packed word, exactly like the plugin.
+      AutoPeekSample sample = UnpackAutoPeekSample(PackAutoPeekSample(script(now - start)));
+      AutoPeekAction action = UpdateAutoPeekDetector(detector, sample, now, settings);
+      if (action == AutoPeekAction::Peek) {
+        ++peeks;
+        last_peek = now;
+      } else if (action == AutoPeekAction::Return) {
+        ++returns;
+      }
+    }
+  }
+};
+
+AutoPeekSample Sample(float speed, float brake, float throttle, bool parking_brake = false) {
+  AutoPeekSample sample;
+  sample.speed = speed;
+  sample.brake = brake;
+  sample.throttle = throttle;
+  sample.parking_brake = parking_brake;
+  return sample;
+}
+
+}  // namespace
+
+int main() {
+  // --- Scripted drive ---
+  Drive drive;
+  drive.settings.enabled = true;
+
+  drive.Run(2.0, [](double) { return Sample(15.0f, 0.0f, 0.4f); });
+  Check(drive.peeks == 0 && drive.detector.state == AutoPeekState::Armed, "driving arms the detector");
+
+  // Brake from 15 m/s to a standstill in 3 s, then wait.
+  double stopped_at = drive.now + 3.0;
+  drive.Run(3.0, [](double t) { return Sample(static_cast<float>(15.0 * (1.0 - t / 3.0)), 0.5f, 0.0f); });
+  drive.Run(5.0, [](double) { return Sample(0.0f, 0.5f, 0.0f); });
+  Check(drive.peeks == 1, "a stop at the line peeks once");
+  Check(drive.last_peek > stopped_at && drive.last_peek < stopped_at + drive.settings.dwell_time + 0.1,
+        "the peek starts after the dwell time");
+
+  // Foot off the brake while still standing: keep peeking.
+  drive.Run(2.0, [](double) { return Sample(0.0f, 0.0f, 0.0f); });
+  Check(drive.returns == 0, "releasing the brake alone keeps the peek");
+
+  drive.Run(0.5, [](double) { return Sample(0.2f, 0.0f, 0.5f); });
+  Check(drive.returns == 1, "pressing the throttle returns the camera");
+
+  // A throttle blip, then standing again: no second peek before driving off.
+  drive.Run(5.0, [](double) { return Sample(0.0f, 0.8f, 0.0f); });
+  Check(drive.peeks == 1, "a second stop without driving off does not peek");
+
+  drive.Run(3.0, [](double t) { return Sample(static_cast<float>(4.0 * t), 0.0f, 0.6f); });
+  Check(drive.detector.state == AutoPeekState::Armed, "driving off re-arms the detector");
+
+  // Parked with the parking brake and no pedals.
+  drive.Run(3.0, [](double t) { return Sample(static_cast<float>(12.0 * (1.0 - t / 3.0)), 0.6f, 0.0f); });
+  drive.Run(5.0, [](double) { return Sample(0.0f, 0.0f, 0.0f, true); });
+  Check(drive.peeks == 2, "the parking brake counts as a stop");
+  drive.Run(2.0, [](double t) { return Sample(static_cast<float>(2.0 * t), 0.0f, 0.0f); });
+  Check(drive.returns == 2, "rolling off returns the camera");
+
+  std::printf("Scripted drive, %.0f s at 60 Hz\n", drive.now);
+  std::printf("  %-44s %10d\n", "peeks started", drive.peeks);
+  std::printf("  %-44s %10d\n", "returns", drive.returns);
+
+  // --- Creeping in a queue ---
+  // Speed swings between 0.2 and 1.2 m/s every 4 s; the brake is on while slowing down.
+  auto creep = [](double t) {
+    float speed = static_cast<float>(0.7 + 0.5 * std::sin(t * 2.0 * 3.14159265 / 4.0));
+    float brake = std::cos(t * 2.0 * 3.14159265 / 4.0) < 0.0 ? 0.3f : 0.0f;
+    return Sample(speed, brake, 0.0f);
+  };
+
+  int naive_toggles = 0;
+  bool naive_peeking = false;
+  for (double t = 0.0; t < 60.0; t += kDt) {
+    AutoPeekSample sample = creep(t);
+    bool standing = sample.speed < drive.settings.stop_speed && sample.brake > 0.0f;
+    naive_toggles += standing != naive_peeking;
+    naive_peeking = standing;
+  }
+
+  Drive queue;
+  queue.settings.enabled = true;
+  queue.Run(1.0, [](double) { return Sample(10.0f, 0.0f, 0.3f); });
+  queue.Run(60.0, creep);
+
+  std::printf("Creeping in a queue for 60 s (0.7 +- 0.5 m/s)\n");
+  std::printf("  %-44s %10d\n", "before: camera toggles (threshold only)", naive_toggles);
+  std::printf("  %-44s %10d\n", "after: camera toggles (dwell + hysteresis)", queue.peeks + queue.returns);
+  Check(queue.peeks + queue.returns <= 2, "creeping does not toggle the peek");
+
+  // --- Cost ---
+  std::printf("Cost\n");
+  std::atomic<uint64_t> word{0};
+  PrintResult("telemetry callback (pack + store)", MeasureNsPerOp(20'000'000, [&](uint64_t i) {
+    word.store(PackAutoPeekSample(Sample(static_cast<float>(i & 31), 0.5f, 0.0f)), std::memory_order_relaxed);
+  }));
+  AutoPeekDetector detector;
+  AutoPeekSettings settings;
+  settings.enabled = true;
+  PrintResult("frame loop (load + unpack + update)", MeasureNsPerOp(20'000'000, [&](uint64_t i) {
+    AutoPeekAction action = UpdateAutoPeekDetector(detector, UnpackAutoPeekSample(word.load(std::memory_order_relaxed)),
+                                                   static_cast<double>(i) * kDt, settings);
+    DoNotOptimize(action);
+  }));
+
+  return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,56 @@
+/**
+ * @file BenchUtils.hpp
+ * @brief Minimal timing helpers shared by the standalone benchmark executables.
+ *
+ * @details The benchmarks are plain executables without a framework dependency so that they
+ * build anywhere the plugin sources build (including Linux). Each one prints a small table of
+ * nanoseconds per operation and returns a non-zero exit code if an accuracy bound is violated.
+ */
+#pragma once
+
+#include <chrono>  // For std::chrono::steady_clock
+#include <cstdint> // For uint64_t
+#include <cstdio>  // For std::printf
+
+namespace SPF_FrontalBlindspotViewer::Bench {
+
+/**
+ * @brief Prevents the optimizer from discarding a value that is otherwise unused.
+ */
+template <typename T>
+inline void DoNotOptimize(const T& value) {
+#if defined(_MSC_VER)
+  static volatile const void* sink;
+  sink = &value;
+#else
+  asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+/**
+ * @brief Runs `fn(i)` for `iterations` iterations and returns the average cost in nanoseconds.
+ */
+template <typename Fn>
+inline double MeasureNsPerOp(uint64_t iterations, Fn&& fn) {
+  // Warm up caches and branch predictors before timing.
+  for (uint64_t i = 0; i < iterations / 10 + 1; ++i) {
+    fn(i);
+  }
+
+  auto begin = std::chrono::steady_clock::now();
+  for (uint64_t i = 0; i < iterations; ++i) {
+    fn(i);
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  return std::chrono::duration<double, std::nano>(end - begin).count() / static_cast<double>(iterations);
+}
+
+/**
+ * @brief Prints a single result row.
+ */
+inline void PrintResult(const char* name, double nsPerOp) {
+  std::printf("  %-44s %10.2f ns/op\n", name, nsPerOp);
+}
+
+}  // namespace SPF_FrontalBlindspotViewer::Bench
@@ -0,0 +1,95 @@
+/**
+ * @file CameraWriterBench.cpp
+ * @brief How many Cam_Set* calls the dirty-tracking output stage saves over a full peek.
+ *
+ * @details Plays the default peek and return animations at a fixed frame rate through each
+ * animation kernel and counts the setter calls made and skipped, compared to the previous three
+ * calls per frame. The cost of the diff itself is reported as well, since it is paid every frame.
+ */
+#include "AnimationKernels.hpp"
+#include "BenchUtils.hpp"
+#include "CameraWriter.hpp"
+
+#include <cstdio> // For std::printf
+
+using namespace SPF_FrontalBlindspotViewer;
+using namespace SPF_FrontalBlindspotViewer::Bench;
+
+namespace {
+
+constexpr float kFrameRate = 60.0f;
+constexpr float kSpeed = 1.1f; // The default animation.speed.
+
+CameraPose SeatPose() {
+  CameraPose pose;
+  pose.fov = 65.0f;
+  return pose;
+}
+
+CameraPose PeekPose() {
+  CameraPose pose;
+  pose.pos[0] = -0.06f;
+  pose.pos[1] = -0.10f;
+  pose.pos[2] = -0.88f;
+  pose.rot[0] = -0.03f;
+  pose.rot[1] = 0.58f;
+  pose.fov = 65.0f; // The FOV is often left at the seat value.
+  return pose;
+}
+
+// Mirrors AnimateCamera: one write per frame and an exact snap at the end.
+uint64_t PlayAnimation(AnimationType type, const CameraPose& start, const CameraPose& end, bool towardsTarget,
+                       CameraWriteCache& cache) {
+  AnimationTrack track;
+  track.start = start;
+  track.end = end;
+  track.towardsTarget = towardsTarget;
+  const AnimationKernel& kernel = SelectAnimationKernel(type);
+  kernel.Prepare(track);
+
+  InvalidateCameraWriteCache(cache);
+  uint64_t frames = 0;
+  float progress = 0.0f;
+  CameraPose pose;
+  while (true) {
+    ++frames;
+    progress += kSpeed / kFrameRate;
+    if (progress >= 1.0f) {
+      CollectCameraWrites(cache, track.end, true);
+      return frames;
+    }
+    kernel.Evaluate(track, progress, pose);
+    CollectCameraWrites(cache, pose);
+  }
+}
+
+void CountWrites(AnimationType type, const char* label) {
+  CameraWriteCache cache;
+  uint64_t frames = PlayAnimation(type, SeatPose(), PeekPose(), true, cache);
+  frames += PlayAnimation(type, PeekPose(), SeatPose(), false, cache);
+
+  std::printf("Peek and return, animation.type = \"%s\", %.0f fps\n", label, kFrameRate);
+  std::printf("  %-44s %10llu\n", "before: calls made", static_cast<unsigned long long>(frames * 3));
+  std::printf("  %-44s %10llu\n", "after: calls made", static_cast<unsigned long long>(cache.stats.calls_made));
+  std::printf("  %-44s %10llu\n", "after: calls skipped", static_cast<unsigned long long>(cache.stats.calls_skipped));
+}
+
+}  // namespace
+
+int main() {
+  CountWrites(AnimationType::Live, "live");
+  CountWrites(AnimationType::Linear, "linear");
+
+  // --- Cost of the diff ---
+  constexpr uint64_t kFrames = 5'000'000;
+  CameraWriteCache cache;
+  CameraPose pose = PeekPose();
+
+  std::printf("Per-frame cost\n");
+  double cost = MeasureNsPerOp(kFrames, [&](uint64_t i) {
+    pose.pos[2] = static_cast<float>(i & 4095) * 1e-3f;
+    DoNotOptimize(CollectCameraWrites(cache, pose));
+  });
+  PrintResult("CollectCameraWrites", cost);
+  return 0;
+}
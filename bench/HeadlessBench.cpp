@@ -0,0 +1,529 @@
+/**
+ * @file HeadlessBench.cpp
+ * @brief The whole plugin driven through the headless framework stand-in.
+ *
+ * @details Loads the plugin the way the framework does (manifest, `OnLoad`, `OnActivated`) and
+ * plays scripted scenarios on a simulated 60 Hz clock: a camera service that is not ready at
+ * startup and then misses the interior camera until its offsets are rescanned, a peek and the way
+ * back, a storm of slider ticks while peeking, a peek recorded to a trace file, an automatic peek
+ * at a stop, switching between peek presets, a "hold to peek" input that is only polled while it
+ * is in use, a peek held against cabin rock, a peek frozen while the game is paused or another
+ * camera is shown, loading every setting per key against one walk of the `settings` subtree (also
+ * with 120 truck profiles, and with a cost per config path segment), and a truck's pose tuned with
+ * the sliders while every save takes 50 ms (saved once, off the frame thread). It then reports the
+ * per-frame cost of `OnUpdate` when idle, when paused, while animating, and during the settings
+ * storm. The executable returns 1 if a scenario leaves the camera anywhere but where it should be,
+ * or if the manifest's default timeline does not parse to `MakeDefaultPeekTimeline`.
+ */
+#include "HeadlessFramework.hpp"
+#include "SPF_FrontalBlindspotViewer.hpp"
+#include "BenchUtils.hpp"
+#include "SettingsSchema.hpp" // For kDefaultTimelineJson
+
+#include <chrono>  // For std::chrono::steady_clock
+#include <cmath>   // For std::fabs, std::fmax, std::sin, std::sqrt
+#include <cstdio>  // For std::printf, std::snprintf, P_tmpdir
+#include <cstring> // For std::memcmp
+#include <string>  // For std::string
+#include <thread>  // For std::this_thread::sleep_for
+
+extern "C" bool SPF_GetManifestAPI(SPF_Manifest_API* out_api);
+
+using namespace SPF_FrontalBlindspotViewer;
+using namespace SPF_FrontalBlindspotViewer::Bench;
+using namespace SPF_FrontalBlindspotViewer::Headless;
+
+namespace {
+
+constexpr double kFrameTime = 1.0 / 60.0;
+constexpr const char* kToggle = "SPF_FrontalBlindspotViewer.toggle";
+constexpr const char* kLeftPillar = "SPF_FrontalBlindspotViewer.peek_left_pillar";
+constexpr const char* kRightPillar = "SPF_FrontalBlindspotViewer.peek_right_pillar";
+constexpr const char* kKerb = "SPF_FrontalBlindspotViewer.peek_kerb";
+constexpr const char* kHold = "SPF_FrontalBlindspotViewer.hold";
+
+int g_failures = 0;
+
+void Check(bool ok, const char* what) {
+  if (!ok) {
+    std::printf("FAILED: %s\n", what);
+    ++g_failures;
+  }
+}
+
+bool CameraAt(const HeadlessFramework& fw, const float pos[3], const float rot[2], float fov) {
+  constexpr float kTolerance = 1e-4f;
+  for (int i = 0; i < 3; ++i) {
+    if (std::fabs(fw.seat_pos[i] - pos[i]) > kTolerance)
+      return false;
+  }
+  for (int i = 0; i < 2; ++i) {
+    if (std::fabs(fw.head_rot[i] - rot[i]) > kTolerance)
+      return false;
+  }
+  return std::fabs(fw.fov - fov) <= kTolerance;
+}
+
+bool CameraAt(const HeadlessFramework& fw, const CameraPose& pose) {
+  return CameraAt(fw, pose.pos, pose.rot, pose.fov);
+}
+
+// Idle frames until the running animation is over (at most ten seconds).
+void RunUntilSettled(HeadlessFramework& fw) {
+  for (int frame = 0; frame < 600 && g_ctx.isAnimating; ++frame)
+    RunHeadlessFrames(fw, 1, kFrameTime);
+}
+
+}  // namespace
+
+int main() {
+  SPF_Manifest_API manifest{};
+  SPF_Plugin_Exports exports{};
+  SPF_GetManifestAPI(&manifest);
+  SPF_GetPlugin(&exports);
+
+  HeadlessFramework fw;
+  const float seat_pos[3] = { 0.3f, 1.2f, 0.5f };
+  const float seat_rot[2] = { 0.1f, -0.05f };
+  const float seat_fov = 65.0f;
+  for (int i = 0; i < 3; ++i)
+    fw.seat_pos[i] = seat_pos[i];
+  fw.head_rot[0] = seat_rot[0];
+  fw.head_rot[1] = seat_rot[1];
+  fw.fov = seat_fov;
+
+  g_ctx.clock = HeadlessNow;
+
+  // --- Scenario: the camera is not ready at startup ---
+  // A 20 s loading screen (reported as paused), then a world in which the interior camera pattern
+  // does not match until the offsets are rescanned.
+  fw.camera_service_ready = false;
+  fw.interior_camera_found = false;
+  fw.refresh_finds_interior = true;
+  StartHeadlessFramework(fw, manifest, exports);
+  SendHeadlessGameState(fw, true);
+  RunHeadlessFrames(fw, 600, kFrameTime);
+  PressHeadlessKeybind(fw, kToggle);
+  RunHeadlessFrames(fw, 600, kFrameTime);
+  uint64_t loading_queries = fw.camera_status_queries;
+  fw.camera_service_ready = true;
+  SendHeadlessGameWorldReady(fw);
+  SendHeadlessGameState(fw, false);
+  while (!g_ctx.cameraAPI && fw.now < 60.0)
+    RunHeadlessFrames(fw, 1, kFrameTime);
+  Check(fw.camera_sets == 0 && fw.camera_gets == 0 && !g_ctx.isPeeking, "nothing touches the camera before it is confirmed");
+  Check(loading_queries <= 10, "a loading screen costs only a few readiness probes");
+  Check(fw.offset_refreshes == 1, "the offsets are rescanned once, not every frame");
+  Check(g_ctx.cameraAPI && g_ctx.camera_binding.time_to_ready < CameraBinding::kRefreshInterval + 0.5,
+        "the camera is bound right after the first allowed rescan finds it");
+  std::printf("Scenario: the camera is not ready at startup\n");
+  std::printf("  %-44s %10llu\n", "readiness probes during 20 s of loading", static_cast<unsigned long long>(loading_queries));
+  std::printf("  %-44s %10.2f s\n", "time to ready", g_ctx.camera_binding.time_to_ready);
+  std::printf("  %-44s %10u\n", "probes until ready", g_ctx.camera_binding.probes);
+  RunHeadlessFrames(fw, 10, kFrameTime);
+
+  // The manifest's timeline default, read back by the plugin, is the built-in timeline.
+  SetHeadlessJson(fw, "settings.animation.timeline", kDefaultTimelineJson);
+  PeekTimeline default_timeline;
+  Check(ReadJsonTimeline(g_ctx.loadAPI->config->Cfg_GetJsonValueHandle(g_ctx.configHandle, "settings.animation.timeline"), default_timeline) &&
+            default_timeline == MakeDefaultPeekTimeline(),
+        "kDefaultTimelineJson matches MakeDefaultPeekTimeline");
+
+  // --- Scenario: peek and back ---
+  const float target_pos[3] = { -0.06f, -0.10f, -0.88f }; // The manifest defaults
+  const float target_rot[2] = { -0.03f, 0.58f };
+  Check(PressHeadlessKeybind(fw, kToggle), "the toggle keybind is registered");
+  RunUntilSettled(fw);
+  Check(CameraAt(fw, target_pos, target_rot, 80.0f), "the peek ends on the target pose");
+  uint64_t peek_sets = fw.camera_sets;
+
+  PressHeadlessKeybind(fw, kToggle);
+  RunUntilSettled(fw);
+  Check(CameraAt(fw, seat_pos, seat_rot, seat_fov), "the way back ends on the seat pose");
+
+  std::printf("Scenario: peek and back\n");
+  std::printf("  %-44s %10llu\n", "camera writes for the peek", static_cast<unsigned long long>(peek_sets));
+  std::printf("  %-44s %10zu\n", "camera calls recorded in total", fw.camera_calls.size());
+
+  // --- Scenario: slider storm while peeking ---
+  PressHeadlessKeybind(fw, kToggle);
+  RunUntilSettled(fw);
+  uint64_t reads_before = fw.config_reads;
+  constexpr int kTicks = 100;
+  float x = 0.0f;
+  for (int tick = 0; tick < kTicks; ++tick) {
+    x = -0.06f + 0.001f * static_cast<float>(tick);
+    ChangeHeadlessSetting(fw, "settings.target_camera.position.x", x);
+    RunHeadlessFrames(fw, 1, kFrameTime);
+  }
+  Check(std::fabs(fw.seat_pos[0] - x) <= 1e-5f, "the live preview follows the slider");
+  std::printf("Scenario: %d slider ticks while peeking\n", kTicks);
+  std::printf("  %-44s %10.2f\n", "config reads per tick",
+              static_cast<double>(fw.config_reads - reads_before) / kTicks);
+  PressHeadlessKeybind(fw, kToggle);
+  RunUntilSettled(fw);
+
+  // --- Scenario: a recorded peek ---
+  fw.logs_dir = P_tmpdir;
+  ChangeHeadlessSetting(fw, "settings.diagnostics.trace_sessions", 1.0);
+  Check(g_ctx.trace_writer.running.load(), "enabling the setting starts the trace writer");
+  PressHeadlessKeybind(fw, kToggle);
+  RunUntilSettled(fw);
+  PressHeadlessKeybind(fw, kToggle);
+  RunUntilSettled(fw);
+  ChangeHeadlessSetting(fw, "settings.diagnostics.trace_sessions", 0.0);
+  Check(!g_ctx.trace_writer.running.load(), "disabling the setting stops the trace writer");
+  Check(g_ctx.trace_writer.frames_written > 0, "the peek frames reach the trace file");
+  std::printf("Scenario: a recorded peek\n");
+  std::printf("  %-44s %10llu\n", "frames written to the trace",
+              static_cast<unsigned long long>(g_ctx.trace_writer.frames_written));
+
+  // --- Scenario: automatic peek at a stop ---
+  ChangeHeadlessSetting(fw, "settings.auto_peek.enabled", 1.0);
+  uint64_t auto_sets = fw.camera_sets;
+  for (int frame = 0; frame < 60; ++frame) {
+    SendHeadlessTruckData(fw, 12.0f, 0.0f, 0.5f);
+    RunHeadlessFrames(fw, 1, kFrameTime);
+  }
+  for (int frame = 0; frame < 180; ++frame) {
+    SendHeadlessTruckData(fw, 0.0f, 0.6f, 0.0f);
+    RunHeadlessFrames(fw, 1, kFrameTime);
+  }
+  RunUntilSettled(fw);
+  Check(g_ctx.isPeeking && CameraAt(fw, g_ctx.target_pos, g_ctx.target_rot, g_ctx.target_fov), "standing with the brake on peeks");
+  SendHeadlessTruckData(fw, 0.1f, 0.0f, 0.4f);
+  RunHeadlessFrames(fw, 1, kFrameTime);
+  RunUntilSettled(fw);
+  Check(!g_ctx.isPeeking && CameraAt(fw, seat_pos, seat_rot, seat_fov), "the throttle brings the camera back");
+
+  // A stop on another camera refuses the peek; the detector waits for the next stop instead.
+  for (int frame = 0; frame < 60; ++frame) {
+    SendHeadlessTruckData(fw, 12.0f, 0.0f, 0.5f);
+    RunHeadlessFrames(fw, 1, kFrameTime);
+  }
+  fw.current_camera = SPF_CAMERA_BEHIND;
+  for (int frame = 0; frame < 180; ++frame) {
+    SendHeadlessTruckData(fw, 0.0f, 0.6f, 0.0f);
+    RunHeadlessFrames(fw, 1, kFrameTime);
+  }
+  Check(!g_ctx.isPeeking && !g_ctx.auto_peek_active && g_ctx.auto_peek.state == AutoPeekState::Disarmed,
+        "a refused automatic peek is not taken for a running one");
+  fw.current_camera = SPF_CAMERA_INTERIOR;
+  RunHeadlessFrames(fw, 30, kFrameTime);
+  ChangeHeadlessSetting(fw, "settings.auto_peek.enabled", 0.0);
+  std::printf("Scenario: automatic peek at a stop\n");
+  std::printf("  %-44s %10llu\n", "camera writes for the peek and back",
+              static_cast<unsigned long long>(fw.camera_sets - auto_sets));
+
+  // --- Scenario: switching between presets ---
+  const CameraPose& left_pose = kDefaultPeekPresets.poses[kPeekPresetLeftPillar];
+  const CameraPose& right_pose = kDefaultPeekPresets.poses[kPeekPresetRightPillar];
+  PressHeadlessKeybind(fw, kToggle);
+  RunUntilSettled(fw);
+  Check(PressHeadlessKeybind(fw, kLeftPillar), "the preset keybinds are registered");
+  float closest_to_seat = 1e9f;
+  uint64_t switch_sets = fw.camera_sets;
+  for (int frame = 0; frame < 600 && g_ctx.isAnimating; ++frame) {
+    RunHeadlessFrames(fw, 1, kFrameTime);
+    float dx = fw.seat_pos[0] - seat_pos[0], dy = fw.seat_pos[1] - seat_pos[1], dz = fw.seat_pos[2] - seat_pos[2];
+    closest_to_seat = std::fmin(closest_to_seat, std::sqrt(dx * dx + dy * dy + dz * dz));
+  }
+  switch_sets = fw.camera_sets - switch_sets;
+  Check(g_ctx.isPeeking && CameraAt(fw, left_pose), "a preset key while peeking moves on to that preset");
+  Check(closest_to_seat > 0.5f, "switching presets does not pass the seat");
+
+  // Change the destination mid-flight, then press the same key again to return.
+  PressHeadlessKeybind(fw, kKerb);
+  RunHeadlessFrames(fw, 10, kFrameTime);
+  PressHeadlessKeybind(fw, kRightPillar);
+  RunUntilSettled(fw);
+  Check(g_ctx.isPeeking && CameraAt(fw, right_pose), "a preset key mid-flight heads for that preset");
+  PressHeadlessKeybind(fw, kRightPillar);
+  RunUntilSettled(fw);
+  Check(!g_ctx.isPeeking && CameraAt(fw, seat_pos, seat_rot, seat_fov), "the active preset's key returns to the seat");
+  std::printf("Scenario: switching between presets\n");
+  std::printf("  %-44s %10llu\n", "camera writes, front to left A-pillar", static_cast<unsigned long long>(switch_sets));
+  std::printf("  %-44s %10.3f m\n", "closest approach to the seat on the way", closest_to_seat);
+
+  // --- Scenario: hold to peek ---
+  // The hold input is only polled from its keybind callback until it is let go again.
+  uint64_t idle_queries = fw.action_value_queries;
+  RunHeadlessFrames(fw, 600, kFrameTime);
+  uint64_t idle_polls = fw.action_value_queries - idle_queries;
+  Check(idle_polls == 0, "an idle hold input is never polled");
+  idle_queries = fw.action_value_queries;
+  fw.action_values[kHold] = 1.0f;
+  Check(PressHeadlessKeybind(fw, kHold), "the hold keybind is registered");
+  RunHeadlessFrames(fw, 180, kFrameTime);
+  Check(g_ctx.isHolding && CameraAt(fw, g_ctx.target_pos, g_ctx.target_rot, g_ctx.target_fov), "holding the input peeks all the way");
+  fw.action_values[kHold] = 0.0f;
+  RunHeadlessFrames(fw, 180, kFrameTime);
+  Check(!g_ctx.isHolding && CameraAt(fw, seat_pos, seat_rot, seat_fov), "letting go of the input returns to the seat");
+  uint64_t hold_queries = fw.action_value_queries - idle_queries;
+  RunHeadlessFrames(fw, 60, kFrameTime);
+  Check(fw.action_value_queries == idle_queries + hold_queries, "polling stops once the input is let go");
+  std::printf("Scenario: hold to peek\n");
+  std::printf("  %-44s %10llu\n", "input polls in 10 idle seconds", static_cast<unsigned long long>(idle_polls));
+  std::printf("  %-44s %10llu\n", "input polls for a 6 s hold and release", static_cast<unsigned long long>(hold_queries));
+
+  // --- Scenario: peek held against cabin rock ---
+  ChangeHeadlessSetting(fw, "settings.stabilization.enabled", 1.0);
+  PressHeadlessKeybind(fw, kToggle);
+  RunUntilSettled(fw);
+  double rock_sq = 0.0;
+  double residual_sq = 0.0;
+  for (int frame = 0; frame < 240; ++frame) {
+    // 2 cm of vertical rock at 1.5 Hz; the first second lets the filter settle.
+    float rock = 0.02f * static_cast<float>(std::sin(frame * kFrameTime * 2.0 * 3.14159265 * 1.5));
+    fw.truck_data.cabin_offset.position.y = rock;
+    SendHeadlessTruckData(fw);
+    RunHeadlessFrames(fw, 1, kFrameTime);
+    if (frame >= 60) {
+      double view = (fw.seat_pos[1] - g_ctx.target_pos[1]) + rock; // Camera height in the world
+      rock_sq += static_cast<double>(rock) * rock;
+      residual_sq += view * view;
+    }
+  }
+  fw.truck_data.cabin_offset.position.y = 0.0f;
+  SendHeadlessTruckData(fw);
+  PressHeadlessKeybind(fw, kToggle);
+  RunUntilSettled(fw);
+  Check(CameraAt(fw, seat_pos, seat_rot, seat_fov), "the way back from a stabilized peek ends on the seat");
+  ChangeHeadlessSetting(fw, "settings.stabilization.enabled", 0.0);
+  double rock_rms = std::sqrt(rock_sq / 180.0);
+  double residual_rms = std::sqrt(residual_sq / 180.0);
+  Check(residual_rms < 0.5 * rock_rms, "the stabilizer cancels most of the cabin rock");
+  std::printf("Scenario: peek held against 2 cm cabin rock at 1.5 Hz\n");
+  std::printf("  %-44s %10.2f mm\n", "view motion RMS, before", rock_rms * 1000.0);
+  std::printf("  %-44s %10.2f mm\n", "view motion RMS, after", residual_rms * 1000.0);
+
+  // --- Scenario: paused and on another camera ---
+  PressHeadlessKeybind(fw, kToggle);
+  RunHeadlessFrames(fw, 20, kFrameTime);
+  float frozen_progress = g_ctx.animation_progress;
+  uint64_t frozen_sets = fw.camera_sets;
+  SendHeadlessGameState(fw, true);
+  RunHeadlessFrames(fw, 120, kFrameTime);
+  Check(fw.camera_sets == frozen_sets && g_ctx.animation_progress == frozen_progress, "a paused game freezes the peek");
+  SendHeadlessGameState(fw, false);
+  RunHeadlessFrames(fw, 2, kFrameTime);
+  Check(g_ctx.animation_progress > frozen_progress && g_ctx.animation_progress < frozen_progress + 0.05f,
+        "the peek continues where it stopped after the pause");
+  frozen_progress = g_ctx.animation_progress;
+  SendHeadlessGameState(fw, false, 0.0f);
+  RunHeadlessFrames(fw, 30, kFrameTime);
+  Check(g_ctx.animation_progress == frozen_progress, "a time scale of zero freezes the peek like a pause");
+  SendHeadlessGameState(fw, false);
+
+  frozen_sets = fw.camera_sets;
+  fw.current_camera = SPF_CAMERA_BEHIND;
+  RunHeadlessFrames(fw, 120, kFrameTime);
+  Check(fw.camera_sets == frozen_sets, "the interior camera is not written while another camera is shown");
+  fw.current_camera = SPF_CAMERA_INTERIOR;
+  RunUntilSettled(fw);
+  Check(g_ctx.isPeeking && CameraAt(fw, g_ctx.target_pos, g_ctx.target_rot, g_ctx.target_fov), "the frozen peek still ends on the target pose");
+
+  // A change of camera while resting on the peek pose puts the pose back on return.
+  fw.current_camera = SPF_CAMERA_BEHIND;
+  RunHeadlessFrames(fw, 2, kFrameTime);
+  fw.seat_pos[1] = 0.0f; // As if the game had reset the interior camera
+  fw.current_camera = SPF_CAMERA_INTERIOR;
+  RunHeadlessFrames(fw, 1, kFrameTime);
+  Check(CameraAt(fw, g_ctx.target_pos, g_ctx.target_rot, g_ctx.target_fov), "returning to the interior camera restores the peek pose");
+  PressHeadlessKeybind(fw, kToggle);
+  RunUntilSettled(fw);
+
+  uint64_t queries = fw.current_camera_queries;
+  RunHeadlessFrames(fw, 600, kFrameTime);
+  queries = fw.current_camera_queries - queries;
+  Check(queries == 0, "an idle plugin does not ask for the active camera");
+
+  // A key pressed on another camera, or while paused, does not start a peek.
+  fw.current_camera = SPF_CAMERA_BEHIND;
+  RunHeadlessFrames(fw, 2, kFrameTime);
+  uint64_t refused_queries = fw.current_camera_queries;
+  PressHeadlessKeybind(fw, kToggle);
+  RunHeadlessFrames(fw, 30, kFrameTime);
+  refused_queries = fw.current_camera_queries - refused_queries;
+  Check(!g_ctx.isAnimating && !g_ctx.isPeeking && CameraAt(fw, seat_pos, seat_rot, seat_fov), "a peek does not start on another camera");
+  // Back on the interior camera with no game state change: the closed gate still notices.
+  uint64_t closed_queries = fw.current_camera_queries;
+  fw.current_camera = SPF_CAMERA_INTERIOR;
+  RunHeadlessFrames(fw, 30, kFrameTime);
+  closed_queries = fw.current_camera_queries - closed_queries;
+  Check(g_ctx.camera_gate.open, "the gate reopens on returning to the interior camera while idle");
+  Check(closed_queries <= 2, "a closed gate is asked about at most every 0.25 s");
+  SendHeadlessGameState(fw, true);
+  PressHeadlessKeybind(fw, kToggle);
+  RunHeadlessFrames(fw, 2, kFrameTime);
+  Check(!g_ctx.isAnimating && !g_ctx.isPeeking, "a peek does not start while paused");
+  SendHeadlessGameState(fw, false);
+  RunHeadlessFrames(fw, 2, kFrameTime);
+  std::printf("Scenario: paused and on another camera\n");
+  std::printf("  %-44s %10llu\n", "camera queries over 10 idle seconds", static_cast<unsigned long long>(queries));
+  std::printf("  %-44s %10llu\n", "camera queries for a refused key press", static_cast<unsigned long long>(refused_queries));
+  std::printf("  %-44s %10llu\n", "camera queries until the gate reopened", static_cast<unsigned long long>(closed_queries));
+
+  // --- Scenario: loading all settings ---
+  // The stand-in config as saved, then with 120 truck profiles; each loaded per key (one config
+  // call per setting) and as one subtree walk, from the same starting snapshot. The framework
+  // splits every config path and looks each segment up again; the load is timed with that free
+  // (the stand-in's in-memory tree) and at a per-segment cost.
+  const SettingsSnapshot settings_before = StagedSettings(g_ctx.settings_exchange);
+  const TruckProfileTable profiles_before = g_ctx.truck_profiles;
+  auto load_settings = [&](bool bulk) {
+    StagedSettings(g_ctx.settings_exchange) = settings_before;
+    g_ctx.truck_profiles = TruckProfileTable();
+    g_ctx.truck_profiles_loaded = false;
+    if (!bulk || !LoadSettingsTree()) {
+      for (int key = 0; key < static_cast<int>(SettingKey::Count); ++key)
+        LoadSetting(static_cast<SettingKey>(key));
+    }
+  };
+
+  std::string many_profiles = "[";
+  for (int i = 0; i < 120; ++i) {
+    char item[160];
+    std::snprintf(item, sizeof(item), "%s{\"truck\": \"brand%d/truck%d\", \"pose\": [%.3f, 1.1, 0.45, 0.2, -0.1, 72.0]}",
+                  i ? ", " : "", i % 12, i, -0.001 * i);
+    many_profiles += item;
+  }
+  many_profiles += "]";
+
+  std::printf("Scenario: loading all settings\n");
+  const char* configs[2][2] = {{"as saved", nullptr}, {"120 truck profiles", many_profiles.c_str()}};
+  for (const auto& config : configs) {
+    if (config[1])
+      SetHeadlessJson(fw, "settings.truck_profiles", config[1]);
+
+    uint64_t config_reads = fw.config_reads, json_reads = fw.json_reads, segments = fw.config_path_segments;
+    load_settings(false);
+    uint64_t per_key_config = fw.config_reads - config_reads, per_key_json = fw.json_reads - json_reads;
+    uint64_t per_key_segments = fw.config_path_segments - segments;
+    const SettingsSnapshot per_key = StagedSettings(g_ctx.settings_exchange);
+    const TruckProfileTable per_key_profiles = g_ctx.truck_profiles;
+
+    config_reads = fw.config_reads, json_reads = fw.json_reads, segments = fw.config_path_segments;
+    load_settings(true);
+    uint64_t bulk_config = fw.config_reads - config_reads, bulk_json = fw.json_reads - json_reads;
+    uint64_t bulk_segments = fw.config_path_segments - segments;
+    Check(std::memcmp(&per_key, &StagedSettings(g_ctx.settings_exchange), sizeof(per_key)) == 0 &&
+              std::memcmp(&per_key_profiles, &g_ctx.truck_profiles, sizeof(per_key_profiles)) == 0,
+          "the subtree walk loads exactly what the per-key loads do");
+    Check(bulk_config == 1, "the subtree walk fetches the config once");
+    Check(!config[1] || g_ctx.truck_profiles.count == 120, "every truck profile is loaded");
+
+    std::printf("  %s\n", config[0]);
+    std::printf("    %-42s %4llu + %5llu\n", "config + JSON reader calls, per key", static_cast<unsigned long long>(per_key_config),
+                static_cast<unsigned long long>(per_key_json));
+    std::printf("    %-42s %4llu + %5llu\n", "config + JSON reader calls, subtree walk", static_cast<unsigned long long>(bulk_config),
+                static_cast<unsigned long long>(bulk_json));
+    std::printf("    %-42s %5llu / %5llu\n", "path segments looked up, per key / walk", static_cast<unsigned long long>(per_key_segments),
+                static_cast<unsigned long long>(bulk_segments));
+    for (int segment_ns : {0, 50, 200}) {
+      fw.config_segment_ns = segment_ns;
+      double per_key_ns = MeasureNsPerOp(2'000, [&](uint64_t) { load_settings(false); });
+      double bulk_ns = MeasureNsPerOp(2'000, [&](uint64_t) { load_settings(true); });
+      char label[64];
+      std::snprintf(label, sizeof(label), "load at %d ns per segment, per key / walk", segment_ns);
+      std::printf("    %-42s %6.2f / %6.2f us\n", label, per_key_ns / 1000.0, bulk_ns / 1000.0);
+    }
+    fw.config_segment_ns = 0;
+  }
+  SetHeadlessJson(fw, "settings.truck_profiles", "[]");
+  StagedSettings(g_ctx.settings_exchange) = settings_before;
+  g_ctx.truck_profiles = profiles_before;
+  g_ctx.truck_profiles_loaded = true;
+
+  // --- Scenario: tuning a truck's pose on a slow disk ---
+  // Two seconds of slider drag while peeking in a known truck, with every Cfg_Save taking 50 ms.
+  fw.config_save_ms = 50;
+  SendHeadlessTruck(fw, "scania", "s_2016");
+  PressHeadlessKeybind(fw, kToggle);
+  RunUntilSettled(fw);
+  uint64_t saves_before = fw.config_saves;
+  uint64_t edits_before = g_ctx.config_saver.changes, coalesced_before = g_ctx.config_saver.coalesced;
+  double slowest_frame = 0.0;
+  auto timed_frame = [&]() {
+    auto begin = std::chrono::steady_clock::now();
+    RunHeadlessFrames(fw, 1, kFrameTime);
+    slowest_frame = std::fmax(slowest_frame, std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count());
+  };
+  float tuned_x = 0.0f;
+  for (int tick = 0; tick < 120; ++tick) {
+    tuned_x = -0.05f + 0.0005f * static_cast<float>(tick);
+    ChangeHeadlessSetting(fw, "settings.target_camera.position.x", tuned_x);
+    timed_frame();
+  }
+  Check(fw.config_saves == saves_before, "nothing is saved while the slider moves");
+  for (int frame = 0; frame < 180; ++frame)
+    timed_frame();
+  for (int wait = 0; wait < 2000 && fw.config_saves == saves_before; ++wait)
+    std::this_thread::sleep_for(std::chrono::milliseconds(1)); // The saver thread's 50 ms
+  Check(fw.config_saves == saves_before + 1, "the drag is saved once, after the slider settles");
+  Check(slowest_frame < 0.005, "a slow save never stalls a frame");
+  Check(fw.foreign_config_writes == 0, "the config is only changed on the frame thread; only the disk write moves off it");
+
+  const SPF_JsonReader_API* reader = fw.core_api.json_reader;
+  SPF_JsonValue_Handle* saved = g_ctx.loadAPI->config->Cfg_GetJsonValueHandle(g_ctx.configHandle, "settings.truck_profiles");
+  SPF_JsonValue_Handle* saved_pose = reader->Json_GetMember(reader->Json_GetArrayItem(saved, 0), "pose");
+  Check(std::fabs(reader->Json_GetFloat(reader->Json_GetArrayItem(saved_pose, 0), 0.0) - tuned_x) < 1e-4, "the save holds the last slider value");
+  std::printf("Scenario: tuning a truck's pose on a slow disk (50 ms per save)\n");
+  std::printf("  %-44s %10llu\n", "slider edits", static_cast<unsigned long long>(g_ctx.config_saver.changes - edits_before));
+  std::printf("  %-44s %10llu\n", "saves", static_cast<unsigned long long>(fw.config_saves - saves_before));
+  std::printf("  %-44s %10llu\n", "saves coalesced away", static_cast<unsigned long long>(g_ctx.config_saver.coalesced - coalesced_before));
+  std::printf("  %-44s %10.3f ms\n", "slowest frame", slowest_frame * 1000.0);
+  PressHeadlessKeybind(fw, kToggle);
+  RunUntilSettled(fw);
+  SendHeadlessTruck(fw, "", ""); // No truck: the slider ticks below do not touch a profile
+  fw.config_save_ms = 0;
+
+  // --- Per-frame cost ---
+  fw.record_camera_calls = false;
+  std::printf("OnUpdate per frame\n");
+
+  uint64_t sets = fw.camera_sets;
+  double idle = MeasureNsPerOp(1'000'000, [&](uint64_t) { RunHeadlessFrames(fw, 1, kFrameTime); });
+  PrintResult("idle", idle);
+  Check(fw.camera_sets == sets, "an idle frame never writes the camera");
+
+  SendHeadlessGameState(fw, true);
+  double paused = MeasureNsPerOp(1'000'000, [&](uint64_t) { RunHeadlessFrames(fw, 1, kFrameTime); });
+  SendHeadlessGameState(fw, false);
+  PrintResult("idle, game paused", paused);
+
+  double animating = MeasureNsPerOp(1'000'000, [&](uint64_t) {
+    if (!g_ctx.isAnimating)
+      PressHeadlessKeybind(fw, kToggle);
+    RunHeadlessFrames(fw, 1, kFrameTime);
+  });
+  PrintResult("animating (peeking back and forth)", animating);
+  RunUntilSettled(fw);
+
+  double storm = MeasureNsPerOp(1'000'000, [&](uint64_t i) {
+    ChangeHeadlessSetting(fw, "settings.target_camera.position.x", -0.06 + 0.0001 * static_cast<double>(i & 255));
+    RunHeadlessFrames(fw, 1, kFrameTime);
+  });
+  PrintResult("settings storm (one change per frame)", storm);
+
+#if SPF_FBV_PROFILING
+  // What the plugin's own timers saw over the whole run (the profiler window's numbers).
+  const char* phases[kProfilePhaseCount] = {"OnUpdate", "AnimateCamera", "OnSettingChanged"};
+  std::printf("In-plugin timers (SPF_FBV_PROFILING)\n");
+  for (int phase = 0; phase < kProfilePhaseCount; ++phase) {
+    LatencySummary summary = SummarizeLatency(g_ctx.profile[phase]);
+    std::printf("  %-20s %10llu calls  p50 %8.0f ns  p99 %8.0f ns  max %8.0f ns\n", phases[phase],
+                static_cast<unsigned long long>(summary.count), summary.p50_ns, summary.p99_ns, summary.max_ns);
+  }
+#endif
+
+  // An edit still waiting for the sliders to settle is saved on unload.
+  SendHeadlessTruck(fw, "scania", "s_2016");
+  RunHeadlessFrames(fw, 1, kFrameTime); // The frame loop picks the truck up
+  ChangeHeadlessSetting(fw, "settings.target_camera.position.x", 0.125);
+  RunHeadlessFrames(fw, 1, kFrameTime);
+  uint64_t saves_at_unload = fw.config_saves;
+  StopHeadlessFramework(fw);
+  Check(fw.config_saves == saves_at_unload + 1, "unloading saves the pending edit");
+  return g_failures == 0 ? 0 : 1;
+}
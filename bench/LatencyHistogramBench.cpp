@@ -0,0 +1,69 @@
+/**
+ * @file LatencyHistogramBench.cpp
+ * @brief Accuracy and overhead of the entry point latency histograms.
+ *
+ * @details Feeds a heavy-tailed (log-normal) latency distribution into a `LatencyHistogram` and
+ * compares its p50/p99 with the exact percentiles of the sorted samples. Then times
+ * `RecordLatency` alone and a full `ScopedLatencyTimer` (two clock reads plus the record), which
+ * is what an entry point pays with `SPF_FBV_PROFILING`; without it the timer is not compiled in.
+ * The executable returns 1 if a percentile is off by more than one bucket width (12.5%).
+ */
+#include "LatencyHistogram.hpp"
+#include "BenchUtils.hpp"
+
+#include <algorithm> // For std::sort
+#include <cmath>     // For std::fabs
+#include <cstdio>    // For std::printf
+#include <random>    // For std::mt19937
+#include <vector>    // For std::vector
+
+using namespace SPF_FrontalBlindspotViewer;
+using namespace SPF_FrontalBlindspotViewer::Bench;
+
+int main() {
+  constexpr int kSamples = 1'000'000;
+
+  // --- Accuracy ---
+  std::mt19937 rng(42);
+  std::lognormal_distribution<double> latency(7.0, 0.8); // Median ~1.1 us, long tail
+
+  static LatencyHistogram histogram;
+  std::vector<uint64_t> samples(kSamples);
+  for (uint64_t& sample : samples) {
+    sample = static_cast<uint64_t>(latency(rng));
+    RecordLatency(histogram, sample);
+  }
+  std::sort(samples.begin(), samples.end());
+  double exact_p50 = static_cast<double>(samples[(kSamples + 1) / 2 - 1]);
+  double exact_p99 = static_cast<double>(samples[kSamples - kSamples / 100 - 1]);
+  double exact_max = static_cast<double>(samples.back());
+
+  LatencySummary summary = SummarizeLatency(histogram);
+  double p50_error = std::fabs(summary.p50_ns - exact_p50) / exact_p50;
+  double p99_error = std::fabs(summary.p99_ns - exact_p99) / exact_p99;
+
+  std::printf("Log-normal latencies, %d samples\n", kSamples);
+  std::printf("  %-44s %10.0f ns (exact %.0f, %.1f%% off)\n", "p50", summary.p50_ns, exact_p50, p50_error * 100.0);
+  std::printf("  %-44s %10.0f ns (exact %.0f, %.1f%% off)\n", "p99", summary.p99_ns, exact_p99, p99_error * 100.0);
+  std::printf("  %-44s %10.0f ns (exact %.0f)\n", "max", summary.max_ns, exact_max);
+  std::printf("  %-44s %10zu bytes\n", "histogram size", sizeof(LatencyHistogram));
+
+  // --- Overhead ---
+  std::printf("Cost per timed call\n");
+  static LatencyHistogram timed;
+  PrintResult("compiled out", 0.0);
+  PrintResult("RecordLatency", MeasureNsPerOp(20'000'000, [&](uint64_t i) {
+    RecordLatency(timed, 200 + (i & 4095));
+  }));
+  PrintResult("ScopedLatencyTimer (clock reads + record)", MeasureNsPerOp(5'000'000, [&](uint64_t i) {
+    ScopedLatencyTimer timer(timed);
+    DoNotOptimize(i);
+  }));
+
+  bool ok = p50_error <= 0.125 && p99_error <= 0.125 && summary.max_ns == exact_max &&
+            summary.count == static_cast<uint64_t>(kSamples);
+  if (!ok) {
+    std::printf("FAILED: histogram summary is off by more than a bucket\n");
+  }
+  return ok ? 0 : 1;
+}
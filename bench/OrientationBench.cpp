@@ -0,0 +1,176 @@
+/**
+ * @file OrientationBench.cpp
+ * @brief Precision and per-frame cost of the quaternion head rotation.
+ *
+ * @details Compares the view direction of `EvaluateOrientationTrack` against an exact slerp in
+ * double precision, separately for the nlerp range (small turns) and the slerp range, over random
+ * head turns from the settings slider ranges. Also checks the yaw/pitch round trip and the exact
+ * end points, and reports how far the separate yaw/pitch interpolation strays from the slerp. Then times one animated frame of the "linear" curve with and without the quaternion
+ * rotation. The executable returns 1 if a check fails.
+ */
+#include "AnimationKernels.hpp"
+#include "BenchUtils.hpp"
+#include "Orientation.hpp"
+
+#include <cmath>   // For std::sin, std::cos, std::acos, std::fabs
+#include <cstdio>  // For std::printf
+#include <random>  // For std::mt19937
+
+using namespace SPF_FrontalBlindspotViewer;
+using namespace SPF_FrontalBlindspotViewer::Bench;
+
+namespace {
+
+constexpr double kMaxNlerpError = 1e-5;  // Radians of view direction, see OrientationTrack
+constexpr double kMaxSlerpError = 1e-4;
+constexpr float kMaxRoundTripError = 1e-5f;
+
+int g_failures = 0;
+
+void Check(bool ok, const char* what) {
+  if (!ok) {
+    std::printf("FAILED: %s\n", what);
+    ++g_failures;
+  }
+}
+
+struct Direction {
+  double x, y, z;
+};
+
+Direction FromYawPitch(double yaw, double pitch) {
+  return { -std::sin(yaw) * std::cos(pitch), std::sin(pitch), -std::cos(yaw) * std::cos(pitch) };
+}
+
+double AngleBetween(const Direction& a, const Direction& b) {
+  double d = a.x * b.x + a.y * b.y + a.z * b.z;
+  return std::acos(d > 1.0 ? 1.0 : (d < -1.0 ? -1.0 : d));
+}
+
+// The exact slerp in double precision, from the same yaw-then-pitch quaternions, as a view direction.
+Direction ExactDirection(double from_yaw, double from_pitch, double to_yaw, double to_pitch, double u) {
+  auto quaternion = [](double yaw, double pitch, double (&q)[4]) {
+    double sy = std::sin(yaw * 0.5), cy = std::cos(yaw * 0.5), sp = std::sin(pitch * 0.5), cp = std::cos(pitch * 0.5);
+    q[0] = cy * sp;
+    q[1] = sy * cp;
+    q[2] = -sy * sp;
+    q[3] = cy * cp;
+  };
+  double a[4], b[4], q[4];
+  quaternion(from_yaw, from_pitch, a);
+  quaternion(to_yaw, to_pitch, b);
+  double d = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+  double sign = d < 0.0 ? -1.0 : 1.0;
+  double angle = std::acos(std::fmin(std::fabs(d), 1.0));
+  double wa = angle < 1e-12 ? 1.0 - u : std::sin((1.0 - u) * angle) / std::sin(angle);
+  double wb = angle < 1e-12 ? u : std::sin(u * angle) / std::sin(angle);
+  for (int i = 0; i < 4; ++i) q[i] = a[i] * wa + b[i] * wb * sign;
+
+  // (0, 0, -1) rotated by q.
+  return { -2.0 * (q[3] * q[1] + q[2] * q[0]), 2.0 * (q[3] * q[0] - q[2] * q[1]), -1.0 + 2.0 * (q[0] * q[0] + q[1] * q[1]) };
+}
+
+}  // namespace
+
+int main() {
+  std::mt19937 rng(2024);
+  // Same ranges as the slider metadata in BuildManifest, short of straight up or down.
+  std::uniform_real_distribution<float> yaw_range(-3.1415f, 3.1415f);
+  std::uniform_real_distribution<float> pitch_range(-1.5f, 1.5f);
+  std::uniform_real_distribution<float> small_turn(-0.08f, 0.08f);
+
+  // --- Round trip ---
+  float worst_round_trip = 0.0f;
+  for (int i = 0; i < 100'000; ++i) {
+    float yaw = yaw_range(rng), pitch = pitch_range(rng), back_yaw, back_pitch;
+    YawPitchFromQuaternion(QuaternionFromYawPitch(yaw, pitch), back_yaw, back_pitch);
+    worst_round_trip = std::fmax(worst_round_trip, std::fmax(std::fabs(back_yaw - yaw), std::fabs(back_pitch - pitch)));
+  }
+  Check(worst_round_trip <= kMaxRoundTripError, "yaw/pitch survive the round trip through a quaternion");
+
+  // --- Precision against the exact slerp ---
+  double worst[2] = {};     // nlerp range, slerp range
+  double euler_stray = 0.0; // Largest distance of the two-angle path from the slerp
+  int tracks[2] = {};
+  for (int trial = 0; trial < 20'000; ++trial) {
+    bool small = (trial & 1) == 0;
+    float from_yaw = yaw_range(rng), from_pitch = pitch_range(rng);
+    float to_yaw = small ? from_yaw + small_turn(rng) : yaw_range(rng);
+    float to_pitch = small ? std::fmax(-1.5f, std::fmin(1.5f, from_pitch + small_turn(rng))) : pitch_range(rng);
+
+    OrientationTrack track;
+    MakeOrientationTrack(from_yaw, from_pitch, to_yaw, to_pitch, track);
+    if (!track.valid) {
+      Check(std::fabs(to_yaw - from_yaw) >= 3.14159265f, "only turns of half a turn or more fall back to yaw/pitch");
+      continue;
+    }
+
+    float yaw, pitch;
+    EvaluateOrientationTrack(track, 0.0f, yaw, pitch);
+    Check(yaw == from_yaw && pitch == from_pitch, "the rotation starts exactly on its start angles");
+    EvaluateOrientationTrack(track, 1.0f, yaw, pitch);
+    Check(yaw == to_yaw && pitch == to_pitch, "the rotation ends exactly on its end angles");
+
+    int range = track.angle < OrientationTrack::kNlerpMaxAngle ? 0 : 1;
+    ++tracks[range];
+    for (int step = 1; step < 64; ++step) {
+      float u = static_cast<float>(step) / 64.0f;
+      EvaluateOrientationTrack(track, u, yaw, pitch);
+      Direction exact = ExactDirection(from_yaw, from_pitch, to_yaw, to_pitch, u);
+      worst[range] = std::fmax(worst[range], AngleBetween(FromYawPitch(yaw, pitch), exact));
+      Check(std::fabs(yaw - (from_yaw + (to_yaw - from_yaw) * u)) < 3.14159265f, "the yaw is unwrapped next to the two-angle yaw");
+
+      Direction euler = FromYawPitch(from_yaw + (to_yaw - from_yaw) * u, from_pitch + (to_pitch - from_pitch) * u);
+      euler_stray = std::fmax(euler_stray, AngleBetween(euler, exact));
+    }
+  }
+  Check(worst[0] <= kMaxNlerpError, "nlerp stays close to the exact slerp for small turns");
+  Check(worst[1] <= kMaxSlerpError, "slerp stays close to the exact slerp");
+
+  std::printf("Precision against the exact slerp (view direction, radians)\n");
+  std::printf("  yaw/pitch round trip %32.2e (bound %.0e)\n", worst_round_trip, kMaxRoundTripError);
+  std::printf("  nlerp, %5d small turns %29.2e (bound %.0e)\n", tracks[0], worst[0], kMaxNlerpError);
+  std::printf("  slerp, %5d turns %35.2e (bound %.0e)\n", tracks[1], worst[1], kMaxSlerpError);
+  std::printf("  separate yaw/pitch, largest distance from the slerp %.3f\n", euler_stray);
+
+  // --- Cost ---
+  auto make_track = [](float yaw_change, bool shortest) {
+    AnimationTrack track;
+    track.start.rot[0] = 0.1f;
+    track.start.rot[1] = -0.05f;
+    track.end.rot[0] = 0.1f + yaw_change;
+    track.end.rot[1] = 0.58f;
+    track.shortest_rotation = shortest;
+    LinearCurve::Prepare(track);
+    return track;
+  };
+  constexpr float kStep = 1.0f / 4096.0f;
+  CameraPose pose;
+  auto measure = [&](const AnimationTrack& track) {
+    return MeasureNsPerOp(5'000'000, [&](uint64_t i) {
+      LinearCurve::Evaluate(track, static_cast<float>(i & 4095) * kStep, pose);
+      DoNotOptimize(pose);
+    });
+  };
+  AnimationTrack euler = make_track(1.2f, false);
+  AnimationTrack nlerp = make_track(0.0f, true);
+  nlerp.end.rot[1] = nlerp.start.rot[1] + 0.05f;
+  LinearCurve::Prepare(nlerp);
+  AnimationTrack slerp = make_track(1.2f, true);
+  Check(nlerp.orientation.valid && nlerp.orientation.angle < OrientationTrack::kNlerpMaxAngle, "the small turn uses nlerp");
+  Check(slerp.orientation.valid && slerp.orientation.angle >= OrientationTrack::kNlerpMaxAngle, "the large turn uses slerp");
+
+  OrientationTrack prepared;
+  double prepare = MeasureNsPerOp(2'000'000, [&](uint64_t i) {
+    MakeOrientationTrack(0.1f + static_cast<float>(i & 1) * 1e-3f, -0.05f, 1.3f, 0.58f, prepared);
+    DoNotOptimize(prepared);
+  });
+
+  std::printf("One animated frame, \"linear\" curve\n");
+  PrintResult("yaw and pitch separately", measure(euler));
+  PrintResult("quaternion, nlerp (small turn)", measure(nlerp));
+  PrintResult("quaternion, slerp", measure(slerp));
+  PrintResult("prepare the rotation (once per trigger)", prepare);
+
+  return g_failures == 0 ? 0 : 1;
+}
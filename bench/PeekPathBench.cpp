@@ -0,0 +1,114 @@
+/**
+ * @file PeekPathBench.cpp
+ * @brief Compares the baked "live" path against the analytic evaluation it replaces.
+ *
+ * @details Reports the per-frame cost of both paths, the one-off bake cost paid in
+ * `OnKeybindAction`, and the worst deviation of the baked reconstruction from the analytic
+ * path over random poses drawn from the settings slider ranges.
+ */
+#include "BenchUtils.hpp"
+#include "PeekPath.hpp"
+
+#include <cmath>   // For std::fabs
+#include <cstdio>  // For std::printf
+#include <random>  // For std::mt19937
+
+using namespace SPF_FrontalBlindspotViewer;
+using namespace SPF_FrontalBlindspotViewer::Bench;
+
+namespace {
+
+// Worst deviation accepted per channel (meters, radians, degrees of FOV). See BakedPath.
+constexpr float kMaxError[kPoseChannelCount] = { 3e-3f, 3e-3f, 3e-3f, 1e-3f, 1e-3f, 1e-3f };
+
+CameraPose RandomPose(std::mt19937& rng) {
+  // Same ranges as the slider metadata in BuildManifest.
+  std::uniform_real_distribution<float> position(-5.0f, 5.0f);
+  std::uniform_real_distribution<float> yaw(-3.1415f, 3.1415f);
+  std::uniform_real_distribution<float> pitch(-1.571f, 1.571f);
+  std::uniform_real_distribution<float> fov(30.0f, 120.0f);
+
+  CameraPose pose;
+  pose.pos[0] = position(rng);
+  pose.pos[1] = position(rng);
+  pose.pos[2] = position(rng);
+  pose.rot[0] = yaw(rng);
+  pose.rot[1] = pitch(rng);
+  pose.fov = fov(rng);
+  return pose;
+}
+
+float Channel(const CameraPose& pose, int channel) {
+  switch (channel) {
+    case kPosX: return pose.pos[0];
+    case kPosY: return pose.pos[1];
+    case kPosZ: return pose.pos[2];
+    case kYaw: return pose.rot[0];
+    case kPitch: return pose.rot[1];
+    default: return pose.fov;
+  }
+}
+
+}  // namespace
+
+int main() {
+  std::mt19937 rng(1234);
+  CameraPose seat = RandomPose(rng);
+  CameraPose target = RandomPose(rng);
+  LivePath path = MakeLivePath(seat, target, true);
+
+  BakedPath baked;
+  BakeLivePath(path, baked);
+
+  constexpr uint64_t kFrames = 2'000'000;
+  constexpr float kStep = 1.0f / 4096.0f;
+
+  std::printf("Peek path (\"live\" mode)\n");
+  CameraPose pose;
+  double analytic = MeasureNsPerOp(kFrames, [&](uint64_t i) {
+    EvaluateLivePath(path, static_cast<float>(i & 4095) * kStep, pose);
+    DoNotOptimize(pose);
+  });
+  double sampled = MeasureNsPerOp(kFrames, [&](uint64_t i) {
+    SampleBakedPath(baked, static_cast<float>(i & 4095) * kStep, pose);
+    DoNotOptimize(pose);
+  });
+  double bake = MeasureNsPerOp(20'000, [&](uint64_t) {
+    BakeLivePath(path, baked);
+    DoNotOptimize(baked);
+  });
+  PrintResult("analytic evaluation (per frame)", analytic);
+  PrintResult("baked table fetch (per frame)", sampled);
+  PrintResult("bake on trigger (once per peek)", bake);
+
+  // --- Accuracy ---
+  float worst_absolute[kPoseChannelCount] = {};
+  for (int trial = 0; trial < 2000; ++trial) {
+    CameraPose a = RandomPose(rng);
+    CameraPose b = RandomPose(rng);
+    LivePath trial_path = MakeLivePath(a, b, (trial & 1) == 0);
+    BakeLivePath(trial_path, baked);
+
+    for (int step = 0; step <= 1000; ++step) {
+      float p = static_cast<float>(step) / 1000.0f;
+      CameraPose exact, approx;
+      EvaluateLivePath(trial_path, p, exact);
+      SampleBakedPath(baked, p, approx);
+
+      for (int c = 0; c < kPoseChannelCount; ++c) {
+        float error = std::fabs(Channel(exact, c) - Channel(approx, c));
+        if (error > worst_absolute[c]) worst_absolute[c] = error;
+      }
+    }
+  }
+
+  static const char* kChannelNames[kPoseChannelCount] = { "pos.x", "pos.y", "pos.z", "yaw", "pitch", "fov" };
+  std::printf("Baked path accuracy (2000 random peeks, slider ranges)\n");
+  bool within_bounds = true;
+  for (int c = 0; c < kPoseChannelCount; ++c) {
+    std::printf("  max |error| %-32s %12.6f (bound %.6f)\n", kChannelNames[c], worst_absolute[c], kMaxError[c]);
+    within_bounds = within_bounds && worst_absolute[c] <= kMaxError[c];
+  }
+
+  return within_bounds ? 0 : 1;
+}
@@ -0,0 +1,149 @@
+/**
+ * @file RetargetBench.cpp
+ * @brief Continuity and latency of turning a peek around mid-flight.
+ *
+ * @details Mirrors what `OnKeybindAction` does when the key is pressed during an animation: the
+ * pose and velocity are sampled on the running track and a new track back to the seat starts from
+ * them. For several interruption points the jump in pose and the change in velocity (per second)
+ * between the last frame of the old track and the first of the new one are reported; the
+ * executable returns 1 if the pose jumps or the velocity changes by more than 2%; the spring
+ * carries the velocity in its own solution. The time until
+ * the camera is back on the seat is compared with the previous behaviour, which ignored the key
+ * until the peek had finished and then played the full return animation.
+ */
+#include "AnimationKernels.hpp"
+#include "BenchUtils.hpp"
+
+#include <algorithm> // For std::max
+#include <cmath>     // For std::fabs, std::sqrt
+#include <cstdio>    // For std::printf
+
+using namespace SPF_FrontalBlindspotViewer;
+using namespace SPF_FrontalBlindspotViewer::Bench;
+
+namespace {
+
+constexpr float kSpeed = 1.1f; // The default animation.speed.
+
+CameraPose SeatPose() {
+  CameraPose pose;
+  pose.fov = 65.0f;
+  return pose;
+}
+
+CameraPose PeekPose() {
+  CameraPose pose;
+  pose.pos[0] = -0.06f;
+  pose.pos[1] = -0.10f;
+  pose.pos[2] = -0.88f;
+  pose.rot[0] = -0.03f;
+  pose.rot[1] = 0.58f;
+  pose.fov = 80.0f;
+  return pose;
+}
+
+float Channel(const CameraPose& pose, int c) {
+  return c < 3 ? pose.pos[c] : (c < 5 ? pose.rot[c - 3] : pose.fov);
+}
+
+float MaxDifference(const CameraPose& a, const CameraPose& b, float scale_b) {
+  float result = 0.0f;
+  for (int c = 0; c < kPoseChannelCount; ++c) {
+    result = std::max(result, std::fabs(Channel(a, c) - Channel(b, c) * scale_b));
+  }
+  return result;
+}
+
+float Magnitude(const CameraPose& v) {
+  float sum = 0.0f;
+  for (int c = 0; c < kPoseChannelCount; ++c) {
+    sum += Channel(v, c) * Channel(v, c);
+  }
+  return std::sqrt(sum);
+}
+
+// The velocity (per unit of progress) at the start of a track. The spring's is read from its
+// solution x(t) = end + (c1 + c2 t)e^(-wt), i.e. c2 - w c1: it bends so sharply at the start that
+// a finite difference in float would mostly measure rounding.
+void StartVelocity(const AnimationKernel& kernel, const AnimationTrack& track, CameraPose& out) {
+  if (!kernel.carries_velocity) {
+    EvaluateTrackVelocity(kernel, track, 0.0f, out);
+    return;
+  }
+  const SpringState& spring = track.spring;
+  for (int c = 0; c < kPoseChannelCount; ++c) {
+    SetPoseChannel(out, c, (Channel(spring.c2, c) - spring.omega * Channel(spring.c1, c)) * track.duration);
+  }
+}
+
+bool Interrupt(AnimationType type, float progress) {
+  const AnimationKernel& kernel = SelectAnimationKernel(type);
+
+  // The running peek.
+  AnimationTrack peek;
+  peek.start = SeatPose();
+  peek.end = PeekPose();
+  peek.towardsTarget = true;
+  kernel.Prepare(peek);
+
+  CameraPose pose, velocity;
+  EvaluateTrack(kernel, peek, progress, pose);
+  EvaluateTrackVelocity(kernel, peek, progress, velocity);
+  float old_speed = peek.duration > 0.0f ? 1.0f / peek.duration : kSpeed;
+
+  // The new track back to the seat, as set up by StartPeekSegment; the spring carries the
+  // velocity (per second) itself.
+  float scale = std::max(progress, 0.2f);
+  AnimationTrack back;
+  back.start = pose;
+  back.end = SeatPose();
+  back.towardsTarget = false;
+  back.spring.velocity = velocity;
+  ScalePose(back.spring.velocity, old_speed);
+  kernel.Prepare(back);
+  float new_speed = back.duration > 0.0f ? 1.0f / back.duration : kSpeed / scale;
+
+  CameraPose carried = velocity;
+  ScalePose(carried, old_speed / new_speed);
+  SetTrackStartVelocity(kernel, back, carried);
+
+  CameraPose new_pose, new_velocity;
+  EvaluateTrack(kernel, back, 0.0f, new_pose);
+  StartVelocity(kernel, back, new_velocity);
+
+  // Both velocities in pose units per second.
+  float jump = MaxDifference(new_pose, pose, 1.0f);
+  float velocity_change = MaxDifference(velocity, new_velocity, new_speed / old_speed) * old_speed;
+  float relative_change = velocity_change / std::max(Magnitude(velocity) * old_speed, 1e-6f);
+
+  float before = (2.0f - progress) / old_speed; // The rest of the peek, then a full way back
+  float after = 1.0f / new_speed;
+  std::printf("  p = %.2f  jump %.1e  velocity change %5.2f%%  back on the seat after %.2f s (before %.2f s)\n",
+              progress, jump, relative_change * 100.0f, after, before);
+  return jump <= 1e-5f && relative_change <= 0.02f;
+}
+
+}  // namespace
+
+int main() {
+  bool ok = true;
+  const float points[] = { 0.1f, 0.3f, 0.5f, 0.7f, 0.9f };
+
+  std::printf("Turning a \"live\" peek around\n");
+  for (float p : points) {
+    ok = Interrupt(AnimationType::Live, p) && ok;
+  }
+  std::printf("Turning a \"linear\" peek around\n");
+  for (float p : points) {
+    ok = Interrupt(AnimationType::Linear, p) && ok;
+  }
+  std::printf("Turning a \"spring\" peek around\n");
+  for (float p : points) {
+    ok = Interrupt(AnimationType::Spring, p) && ok;
+  }
+
+  if (!ok) {
+    std::printf("FAILED: the interrupted animation is not continuous\n");
+  }
+  return ok ? 0 : 1;
+}
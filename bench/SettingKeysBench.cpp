@@ -0,0 +1,183 @@
+/**
+ * @file SettingKeysBench.cpp
+ * @brief Cost of routing one `OnSettingChanged` call, old `strstr` chain vs. hashed lookup.
+ *
+ * @details "before" is what a slider tick used to cost: matching the path against the target
+ * camera groups with `strstr` and re-reading every setting (13 config reads). "after" is
+ * `FindSettingKey` followed by a single read. The `strstr` chain only tells a target camera path
+ * from the rest, so the lookup is also timed against the simplest scan that names the setting: a
+ * `strcmp` against every known path, the way the plugin sees them (with and without the
+ * `settings.` prefix). The executable returns 1 if any known path does not map back to its own
+ * key (with or without the `settings.` prefix) or a foreign path is matched.
+ *
+ * Also checks the text generated from the settings schema (balanced defaults JSON naming every
+ * setting, metadata for every slider), the unit conversion of `StoreSettingValue` and the pose
+ * field offsets, and times the slider metadata of the manifest: built with `std::to_string`
+ * (before) or generated at compile time (after).
+ */
+#include "SettingKeys.hpp"
+#include "SettingsSchema.hpp"
+#include "BenchUtils.hpp"
+
+#include <cmath>   // For std::fabs
+#include <cstdio>  // For std::printf
+#include <cstring> // For std::strstr, std::strrchr, std::strcmp, std::strncmp
+#include <string>  // For std::string, std::to_string
+
+using namespace SPF_FrontalBlindspotViewer;
+using namespace SPF_FrontalBlindspotViewer::Bench;
+
+namespace {
+
+// The matching done by the old OnSettingChanged.
+bool IsTargetCameraPathStrstr(const char* keyPath) {
+  return std::strstr(keyPath, "target_camera.position") || std::strstr(keyPath, "target_camera.rotation") ||
+         std::strstr(keyPath, "target_camera.fov");
+}
+
+// The simplest lookup that resolves the setting itself: one comparison per known path.
+SettingKey FindSettingKeyByScan(const char* keyPath) {
+  bool has_prefix = std::strncmp(keyPath, "settings.", 9) == 0;
+  for (int key = 0; key < static_cast<int>(SettingKey::Count); ++key) {
+    if (std::strcmp(has_prefix ? kSettingPaths[key] : kSettingPaths[key] + 9, keyPath) == 0)
+      return static_cast<SettingKey>(key);
+  }
+  return SettingKey::Unknown;
+}
+
+}  // namespace
+
+int main() {
+  constexpr int kKeyCount = static_cast<int>(SettingKey::Count);
+
+  // --- Correctness ---
+  int failures = 0;
+  for (int key = 0; key < kKeyCount; ++key) {
+    const char* path = kSettingPaths[key];
+    if (FindSettingKey(path) != static_cast<SettingKey>(key)) {
+      std::printf("FAILED: %s\n", path);
+      ++failures;
+    }
+    if (FindSettingKey(path + 9) != static_cast<SettingKey>(key)) {
+      std::printf("FAILED: %s (without prefix)\n", path + 9);
+      ++failures;
+    }
+  }
+  const char* foreign[] = {"settings.target_camera", "settings.animation", "target_camera.position.w",
+                           "settings.animation.speedy", "", "settings."};
+  for (const char* path : foreign) {
+    if (FindSettingKey(path) != SettingKey::Unknown) {
+      std::printf("FAILED: foreign path \"%s\" matched\n", path);
+      ++failures;
+    }
+  }
+  if (FindSettingKey(nullptr) != SettingKey::Unknown) {
+    std::printf("FAILED: null path matched\n");
+    ++failures;
+  }
+
+  // --- Generated manifest text ---
+  const char* defaults = SettingsDefaultsJson();
+  int depth = 0;
+  bool balanced = true;
+  for (const char* c = defaults; *c; ++c) {
+    depth += (*c == '{' || *c == '[') - (*c == '}' || *c == ']');
+    balanced &= depth >= 0;
+  }
+  if (!balanced || depth != 0) {
+    std::printf("FAILED: the defaults JSON is not balanced\n");
+    ++failures;
+  }
+  for (int key = 0; key < kKeyCount; ++key) {
+    const char* leaf = std::strrchr(kSettingPaths[key], '.') + 1;
+    std::string quoted = "\"" + std::string(leaf) + "\":";
+    SettingMeta meta;
+    bool has_meta = GetSettingMeta(static_cast<SettingKey>(key), meta);
+    if (!std::strstr(defaults, quoted.c_str()) ||
+        (kSettingSchema[key].widget == SettingWidget::Slider && (!has_meta || !meta.params || !std::strstr(meta.params, "\"max\"")))) {
+      std::printf("FAILED: generated text for %s\n", kSettingPaths[key]);
+      ++failures;
+    }
+  }
+
+  SettingsSnapshot snapshot;
+  StoreSettingValue(snapshot, GetSettingSchema(SettingKey::AnimationMaxStep), 80.0);
+  StoreSettingValue(snapshot, GetSettingSchema(SettingKey::HoldSmoothing), -20.0);
+  StoreSettingValue(snapshot, GetSettingSchema(SettingKey::AutoPeekStopSpeed), 3.6);
+  StoreSettingValue(snapshot, GetSettingSchema(SettingKey::AnimationType), static_cast<double>(AnimationType::Spring));
+  StoreSettingValue(snapshot, GetSettingSchema(SettingKey::TargetFov), 70.0);
+  if (std::fabs(snapshot.clock.max_step - 0.08) > 1e-12 || snapshot.hold_filter.smoothing_time != 0.0f ||
+      std::fabs(snapshot.auto_peek.stop_speed - 1.0f) > 1e-6f || snapshot.animation_type != AnimationType::Spring ||
+      snapshot.presets.poses[kPeekPresetFront].fov != 70.0f) {
+    std::printf("FAILED: StoreSettingValue\n");
+    ++failures;
+  }
+
+  // The pose offsets are computed by hand (no array designators in offsetof); check them.
+  CameraPose& front = snapshot.presets.poses[kPeekPresetFront];
+  float* channels[kPoseChannelCount] = {&front.pos[0], &front.pos[1], &front.pos[2], &front.rot[0], &front.rot[1], &front.fov};
+  for (int c = 0; c < kPoseChannelCount; ++c) {
+    if (&SettingField<float>(snapshot, GetSettingSchema(static_cast<SettingKey>(c))) != channels[c]) {
+      std::printf("FAILED: offset of %s\n", kSettingPaths[c]);
+      ++failures;
+    }
+  }
+  const SettingKey preset_keys[] = {SettingKey::PresetLeftPillar, SettingKey::PresetRightPillar, SettingKey::PresetKerb};
+  const int presets[] = {kPeekPresetLeftPillar, kPeekPresetRightPillar, kPeekPresetKerb};
+  for (int i = 0; i < 3; ++i) {
+    if (&SettingField<CameraPose>(snapshot, GetSettingSchema(preset_keys[i])) != &snapshot.presets.poses[presets[i]]) {
+      std::printf("FAILED: offset of %s\n", GetSettingSchema(preset_keys[i]).path);
+      ++failures;
+    }
+  }
+
+  // --- Cost ---
+  std::printf("Routing one setting change (%d known paths)\n", kKeyCount);
+  double before = MeasureNsPerOp(5'000'000, [&](uint64_t i) {
+    DoNotOptimize(IsTargetCameraPathStrstr(kSettingPaths[i % kKeyCount]));
+  });
+  PrintResult("before: strstr chain", before);
+  double after = MeasureNsPerOp(5'000'000, [&](uint64_t i) {
+    DoNotOptimize(FindSettingKey(kSettingPaths[i % kKeyCount]));
+  });
+  PrintResult("after: FindSettingKey", after);
+  double scan = MeasureNsPerOp(5'000'000, [&](uint64_t i) {
+    DoNotOptimize(FindSettingKeyByScan(kSettingPaths[i % kKeyCount]));
+  });
+  PrintResult("reference: strcmp scan, full path", scan);
+  double short_after = MeasureNsPerOp(5'000'000, [&](uint64_t i) {
+    DoNotOptimize(FindSettingKey(kSettingPaths[i % kKeyCount] + 9));
+  });
+  PrintResult("after: FindSettingKey, without prefix", short_after);
+  double short_scan = MeasureNsPerOp(5'000'000, [&](uint64_t i) {
+    DoNotOptimize(FindSettingKeyByScan(kSettingPaths[i % kKeyCount] + 9));
+  });
+  PrintResult("reference: strcmp scan, without prefix", short_scan);
+
+  std::printf("Slider metadata of the manifest (%d settings)\n", kKeyCount);
+  double built = MeasureNsPerOp(20'000, [&](uint64_t) {
+    for (int key = 0; key < kKeyCount; ++key) {
+      const SettingSchema& schema = kSettingSchema[key];
+      if (schema.widget != SettingWidget::Slider)
+        continue;
+      std::string params = "{ \"min\": " + std::to_string(schema.min) + ", \"max\": " + std::to_string(schema.max) +
+                           ", \"format\": \"" + schema.format + "\" }";
+      DoNotOptimize(params);
+    }
+  });
+  PrintResult("before: std::to_string per slider", built);
+  double generated = MeasureNsPerOp(20'000, [&](uint64_t) {
+    for (int key = 0; key < kKeyCount; ++key) {
+      SettingMeta meta;
+      DoNotOptimize(GetSettingMeta(static_cast<SettingKey>(key), meta));
+      DoNotOptimize(meta);
+    }
+  });
+  PrintResult("after: generated at compile time", generated);
+
+  std::printf("Config reads per slider tick\n");
+  std::printf("  %-44s %10d\n", "before: LoadSettings", 13);
+  std::printf("  %-44s %10d\n", "after: LoadSetting(key)", 1);
+
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,149 @@
+/**
+ * @file SettingsSnapshotBench.cpp
+ * @brief Stress test of the settings hand-over between a config thread and the frame loop.
+ *
+ * @details A writer thread publishes snapshots as fast as it can while a reader thread plays the
+ * frame loop, taking the latest snapshot and checking that every field belongs to the same
+ * publication. "before" does the same with the fields written in place (as the plugin used to),
+ * modelled with relaxed atomics so the test itself stays free of data races. The executable
+ * returns 1 if the exchange ever shows a torn snapshot or goes back in time.
+ */
+#include "SettingsSnapshot.hpp"
+#include "BenchUtils.hpp"
+
+#include <atomic>  // For std::atomic
+#include <cstdio>  // For std::printf
+#include <thread>  // For std::thread
+
+using namespace SPF_FrontalBlindspotViewer;
+using namespace SPF_FrontalBlindspotViewer::Bench;
+
+namespace {
+
+constexpr uint64_t kPublications = 2'000'000;
+
+// Every field of publication `n` is derived from `n`, so a mix of two publications is detectable.
+void FillSnapshot(SettingsSnapshot& snapshot, uint64_t n) {
+  float value = static_cast<float>(n & 0xFFFFF); // Exactly representable
+  for (int c = 0; c < kPoseChannelCount; ++c)
+    SetPoseChannel(snapshot.presets.poses[kPeekPresetFront], c, value + static_cast<float>(c));
+  snapshot.animation_speed = value;
+  snapshot.spring_stiffness = value + 1.0f;
+  snapshot.hold_filter.max_rate = value;
+  snapshot.write_epsilon = value + 2.0f;
+}
+
+bool IsConsistent(const SettingsSnapshot& snapshot) {
+  float value = static_cast<float>(snapshot.generation & 0xFFFFF);
+  for (int c = 0; c < kPoseChannelCount; ++c) {
+    if (GetPoseChannel(snapshot.presets.poses[kPeekPresetFront], c) != value + static_cast<float>(c))
+      return false;
+  }
+  return snapshot.animation_speed == value && snapshot.spring_stiffness == value + 1.0f &&
+         snapshot.hold_filter.max_rate == value && snapshot.write_epsilon == value + 2.0f;
+}
+
+// The old layout: the reader sees each field as soon as it is written.
+struct InPlaceSettings {
+  std::atomic<float> fields[kPoseChannelCount];
+  std::atomic<uint64_t> last{0};
+};
+
+}  // namespace
+
+int main() {
+  // --- After: triple buffer ---
+  SettingsExchange exchange;
+  uint64_t torn = 0;
+  uint64_t reversed = 0;
+  uint64_t taken = 0;
+  uint64_t frames = 0;
+
+  std::thread writer([&] {
+    for (uint64_t n = 1; n <= kPublications; ++n) {
+      FillSnapshot(StagedSettings(exchange), n);
+      // Hand the CPU over mid-update now and then, so the two sides interleave even on a single core.
+      if ((n & 255) == 0)
+        std::this_thread::yield();
+      PublishSettings(exchange, kAllSettings);
+    }
+  });
+  std::thread reader([&] {
+    uint64_t last = 0;
+    while (last < kPublications) {
+      ++frames;
+      if (!AcquireSettings(exchange)) {
+        std::this_thread::yield();
+        continue;
+      }
+      const SettingsSnapshot& snapshot = CurrentSettings(exchange);
+      ++taken;
+      torn += !IsConsistent(snapshot);
+      reversed += snapshot.generation <= last;
+      last = snapshot.generation;
+    }
+  });
+  writer.join();
+  reader.join();
+
+  // --- Before: fields written in place ---
+  InPlaceSettings in_place;
+  for (int c = 0; c < kPoseChannelCount; ++c)
+    in_place.fields[c].store(static_cast<float>(c));
+  uint64_t torn_before = 0;
+  uint64_t frames_before = 0;
+  std::thread writer_before([&] {
+    for (uint64_t n = 1; n <= kPublications; ++n) {
+      float value = static_cast<float>(n & 0xFFFFF);
+      for (int c = 0; c < kPoseChannelCount; ++c) {
+        in_place.fields[c].store(value + static_cast<float>(c), std::memory_order_relaxed);
+        if (c == 2 && (n & 255) == 0)
+          std::this_thread::yield();
+      }
+    }
+    in_place.last.store(1, std::memory_order_release);
+  });
+  std::thread reader_before([&] {
+    while (in_place.last.load(std::memory_order_acquire) == 0) {
+      ++frames_before;
+      std::this_thread::yield();
+      float base = in_place.fields[0].load(std::memory_order_relaxed);
+      for (int c = 1; c < kPoseChannelCount; ++c) {
+        if (in_place.fields[c].load(std::memory_order_relaxed) != base + static_cast<float>(c)) {
+          ++torn_before;
+          break;
+        }
+      }
+    }
+  });
+  writer_before.join();
+  reader_before.join();
+
+  std::printf("Writer publishing %llu times while the reader polls\n", static_cast<unsigned long long>(kPublications));
+  std::printf("  %-44s %10llu of %llu reads\n", "before: torn target poses (in place)", static_cast<unsigned long long>(torn_before),
+              static_cast<unsigned long long>(frames_before));
+  std::printf("  %-44s %10llu of %llu taken\n", "after: torn snapshots", static_cast<unsigned long long>(torn),
+              static_cast<unsigned long long>(taken));
+  std::printf("  %-44s %10llu\n", "after: snapshots older than the last one", static_cast<unsigned long long>(reversed));
+  std::printf("  %-44s %10llu\n", "after: reader polls", static_cast<unsigned long long>(frames));
+
+  // --- Per-frame cost ---
+  std::printf("Single-threaded cost\n");
+  SettingsExchange idle;
+  PublishSettings(idle, kAllSettings);
+  AcquireSettings(idle);
+  PrintResult("AcquireSettings, nothing new", MeasureNsPerOp(20'000'000, [&](uint64_t) {
+    DoNotOptimize(AcquireSettings(idle));
+  }));
+  PrintResult("PublishSettings + AcquireSettings", MeasureNsPerOp(5'000'000, [&](uint64_t i) {
+    StagedSettings(idle).animation_speed = static_cast<float>(i & 1023);
+    PublishSettings(idle, SettingBit(SettingKey::AnimationSpeed));
+    DoNotOptimize(AcquireSettings(idle));
+  }));
+
+  bool ok = torn == 0 && reversed == 0 && CurrentSettings(exchange).generation == kPublications;
+  if (!ok) {
+    std::printf("FAILED: the reader saw a torn, stale or reordered snapshot\n");
+  }
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,182 @@
+/**
+ * @file TimelineBench.cpp
+ * @brief Correctness and per-frame cost of the keyframe timelines.
+ *
+ * @details Checks the built-in "lean, pause, look up, settle" timeline: it starts and ends exactly
+ * on its poses in both directions, holds during the pause, moves continuously, and a cursor that
+ * is carried from frame to frame finds the same values as a fresh one. Invalid key sets must be
+ * rejected. Then times one animated frame of the baked "live" curve against the timeline, with
+ * the cached cursor and with a cursor that starts from the first segment every frame, for the
+ * built-in timeline and one with the maximum number of keys. The executable returns 1 if a check
+ * fails.
+ */
+#include "AnimationKernels.hpp"
+#include "BenchUtils.hpp"
+
+#include <cmath>  // For std::fabs
+#include <cstdio> // For std::printf
+
+using namespace SPF_FrontalBlindspotViewer;
+using namespace SPF_FrontalBlindspotViewer::Bench;
+
+namespace {
+
+constexpr int kFramesPerPeek = 60; // One second at 60 Hz
+
+int g_failures = 0;
+
+void Check(bool ok, const char* what) {
+  if (!ok) {
+    std::printf("FAILED: %s\n", what);
+    ++g_failures;
+  }
+}
+
+CameraPose Seat() {
+  CameraPose pose;
+  pose.pos[0] = 0.3f;
+  pose.pos[1] = 1.2f;
+  pose.pos[2] = 0.5f;
+  pose.rot[0] = 0.1f;
+  pose.rot[1] = -0.05f;
+  pose.fov = 65.0f;
+  return pose;
+}
+
+CameraPose Peek() {
+  CameraPose pose;
+  pose.pos[0] = -0.06f;
+  pose.pos[1] = 1.1f;
+  pose.pos[2] = -0.38f;
+  pose.rot[0] = -0.03f;
+  pose.rot[1] = 0.58f;
+  pose.fov = 80.0f;
+  return pose;
+}
+
+bool SamePose(const CameraPose& a, const CameraPose& b, float tolerance) {
+  for (int c = 0; c < kPoseChannelCount; ++c) {
+    if (std::fabs(GetPoseChannel(a, c) - GetPoseChannel(b, c)) > tolerance)
+      return false;
+  }
+  return true;
+}
+
+AnimationTrack MakeTrack(AnimationType type, const PeekTimeline* timeline, bool towards_target) {
+  AnimationTrack track;
+  track.start = towards_target ? Seat() : Peek();
+  track.end = towards_target ? Peek() : Seat();
+  track.towardsTarget = towards_target;
+  track.timeline = timeline;
+  SelectAnimationKernel(type).Prepare(track);
+  return track;
+}
+
+// Every channel with the maximum number of keys, evenly spaced.
+PeekTimeline MakeDenseTimeline() {
+  PeekTimeline timeline;
+  TimelineKey keys[PeekTimeline::kMaxAuthoredKeys];
+  for (int k = 0; k < PeekTimeline::kMaxAuthoredKeys; ++k) {
+    keys[k].time = static_cast<float>(k + 1) / (PeekTimeline::kMaxAuthoredKeys + 1);
+    keys[k].amount = keys[k].time;
+  }
+  for (int c = 0; c < kPoseChannelCount; ++c)
+    SetTimelineChannel(timeline, c, keys, PeekTimeline::kMaxAuthoredKeys);
+  return timeline;
+}
+
+// One peek's worth of frames, the way the plugin evaluates them.
+template <typename Evaluate>
+double MeasurePeekFrames(Evaluate&& evaluate) {
+  CameraPose pose;
+  return MeasureNsPerOp(6'000'000, [&](uint64_t i) {
+    evaluate(static_cast<float>(i % (kFramesPerPeek + 1)) / kFramesPerPeek, pose);
+    DoNotOptimize(pose);
+  });
+}
+
+}  // namespace
+
+int main() {
+  const PeekTimeline timeline = MakeDefaultPeekTimeline();
+  const AnimationKernel& kernel = SelectAnimationKernel(AnimationType::Timeline);
+
+  // --- End points, both directions ---
+  for (bool towards : { true, false }) {
+    AnimationTrack track = MakeTrack(AnimationType::Timeline, &timeline, towards);
+    CameraPose pose;
+    kernel.Evaluate(track, 0.0f, pose);
+    Check(SamePose(pose, track.start, 0.0f), "the timeline starts exactly on its start pose");
+    kernel.Evaluate(track, 1.0f, pose);
+    Check(SamePose(pose, track.end, 0.0f), "the timeline ends exactly on its end pose");
+  }
+
+  // --- The pause, the look-up and continuity ---
+  AnimationTrack track = MakeTrack(AnimationType::Timeline, &timeline, true);
+  CameraPose a, b;
+  kernel.Evaluate(track, 0.46f, a);
+  kernel.Evaluate(track, 0.59f, b);
+  Check(a.pos[0] == b.pos[0] && a.pos[2] == b.pos[2], "the lean is held during the pause");
+  Check(a.rot[1] == track.start.rot[1], "the pitch waits until the pause is over");
+
+  float largest_step = 0.0f;
+  float highest_pitch = -1e9f;
+  kernel.Evaluate(track, 0.0f, a);
+  for (int i = 1; i <= 10'000; ++i) {
+    kernel.Evaluate(track, static_cast<float>(i) / 10'000.0f, b);
+    for (int c = 0; c < kFov; ++c)
+      largest_step = std::fmax(largest_step, std::fabs(GetPoseChannel(b, c) - GetPoseChannel(a, c)));
+    highest_pitch = std::fmax(highest_pitch, b.rot[1]);
+    a = b;
+  }
+  Check(largest_step < 1e-3f, "the timeline moves without jumps");
+  Check(highest_pitch > track.end.rot[1], "the look-up overshoots before it settles");
+
+  // --- Cursor: carried from frame to frame versus fresh, including reversals ---
+  int mismatches = 0;
+  TimelineCursor carried;
+  uint32_t state = 12345;
+  for (int i = 0; i < 100'000; ++i) {
+    state = state * 1664525u + 1013904223u;
+    float t = static_cast<float>(state >> 8) / static_cast<float>(1u << 24);
+    TimelineCursor fresh;
+    EvaluateTimeline(timeline, track.start, track.end, t, carried, a);
+    EvaluateTimeline(timeline, track.start, track.end, t, fresh, b);
+    mismatches += !SamePose(a, b, 0.0f);
+  }
+  Check(mismatches == 0, "the cached cursor finds the same segment as a fresh one");
+
+  // --- Invalid key sets ---
+  PeekTimeline edited = timeline;
+  const TimelineKey out_of_order[] = { { 0.6f, 0.5f, 0.0f, TimelineEasing::Linear }, { 0.4f, 0.8f, 0.0f, TimelineEasing::Linear } };
+  const TimelineKey at_zero[] = { { 0.0f, 0.5f, 0.0f, TimelineEasing::Linear } };
+  TimelineKey too_many[PeekTimeline::kMaxAuthoredKeys + 1];
+  for (int k = 0; k <= PeekTimeline::kMaxAuthoredKeys; ++k)
+    too_many[k].time = 0.05f * static_cast<float>(k + 1);
+  Check(!SetTimelineChannel(edited, kPosX, out_of_order, 2), "keys out of order are rejected");
+  Check(!SetTimelineChannel(edited, kPosX, at_zero, 1), "a key at t = 0 is rejected");
+  Check(!SetTimelineChannel(edited, kPosX, too_many, PeekTimeline::kMaxAuthoredKeys + 1), "too many keys are rejected");
+  Check(edited == timeline, "a rejected key set leaves the channel unchanged");
+
+  // --- Cost ---
+  std::printf("One animated frame (%d frames per peek)\n", kFramesPerPeek);
+  AnimationTrack live = MakeTrack(AnimationType::Live, nullptr, true);
+  const AnimationKernel& live_kernel = SelectAnimationKernel(AnimationType::Live);
+  PrintResult("live (baked table)", MeasurePeekFrames([&](float p, CameraPose& out) { live_kernel.Evaluate(live, p, out); }));
+
+  PrintResult("timeline, cached cursor", MeasurePeekFrames([&](float p, CameraPose& out) { kernel.Evaluate(track, p, out); }));
+  PrintResult("timeline, search from the first key", MeasurePeekFrames([&](float p, CameraPose& out) {
+    track.timeline_cursor = TimelineCursor();
+    kernel.Evaluate(track, p, out);
+  }));
+
+  const PeekTimeline dense = MakeDenseTimeline();
+  AnimationTrack dense_track = MakeTrack(AnimationType::Timeline, &dense, true);
+  PrintResult("dense timeline (8 keys per channel), cached", MeasurePeekFrames([&](float p, CameraPose& out) { kernel.Evaluate(dense_track, p, out); }));
+  PrintResult("dense timeline, search from the first key", MeasurePeekFrames([&](float p, CameraPose& out) {
+    dense_track.timeline_cursor = TimelineCursor();
+    kernel.Evaluate(dense_track, p, out);
+  }));
+
+  return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,175 @@
+/**
+ * @file TraceRecorderBench.cpp
+ * @brief Cost of recording a peek frame and soundness of the background trace writer.
+ *
+ * @details Times `PushTraceFrame` (what the frame loop pays per animated frame while a recording
+ * is on: one binary record into the ring) apart from `FormatTraceFrame` (what the writer thread
+ * pays to turn it into text), next to the `snprintf` formatting it replaced. Then pushes a burst
+ * of frames while a real `TraceWriter` drains the ring into a temporary file, yielding now and
+ * then so the writer also gets to run on a single core, and times `StopTraceWriter`. The
+ * executable returns 1 if the text differs from the `snprintf` text, if a frame is neither
+ * written nor counted as dropped, if stopping waits on the drain interval, or if the file is not
+ * a closed JSON document.
+ */
+#include "TraceRecorder.hpp"
+#include "BenchUtils.hpp"
+
+#include <chrono>  // For std::chrono::steady_clock
+#include <cstdio>  // For std::printf, std::fopen, std::snprintf
+#include <cstring> // For std::strstr, std::memcmp
+#include <string>  // For std::string
+#include <thread>  // For std::this_thread::yield
+
+using namespace SPF_FrontalBlindspotViewer;
+using namespace SPF_FrontalBlindspotViewer::Bench;
+
+namespace {
+
+TraceFrame MakeFrame(uint64_t i) {
+  TraceFrame frame;
+  frame.time = static_cast<double>(i) / 60.0;
+  frame.frame_time = 1.0f / 60.0f;
+  frame.progress = static_cast<float>(i & 63) / 63.0f;
+  frame.pose = CameraPose{ { 0.3f, 1.2f, 0.5f }, { 0.1f, -0.05f }, 65.0f };
+  frame.calls_made = 3;
+  frame.flags = kTraceTowardsTarget;
+  frame.session = static_cast<uint32_t>(i >> 6);
+  return frame;
+}
+
+// The formatting FormatTraceFrame replaced, for its cost and its text.
+int FormatTraceFrameWithSnprintf(const TraceFrame& frame, char* buffer, int size) {
+  double end_us = frame.time * 1e6;
+  double duration_us = frame.frame_time * 1e6;
+  const char* name = frame.kind == kTraceHold ? "hold" : ((frame.flags & kTraceTowardsTarget) ? "peek" : "return");
+  const CameraPose& p = frame.pose;
+  int length = std::snprintf(buffer, static_cast<size_t>(size),
+      "{\"name\":\"%s\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f,"
+      "\"args\":{\"session\":%u,\"progress\":%.5f,\"hitch\":%s}},\n"
+      "{\"name\":\"progress\",\"ph\":\"C\",\"pid\":1,\"ts\":%.3f,\"args\":{\"progress\":%.5f}},\n"
+      "{\"name\":\"frame time (ms)\",\"ph\":\"C\",\"pid\":1,\"ts\":%.3f,\"args\":{\"dt\":%.3f}},\n"
+      "{\"name\":\"position\",\"ph\":\"C\",\"pid\":1,\"ts\":%.3f,\"args\":{\"x\":%.5f,\"y\":%.5f,\"z\":%.5f}},\n"
+      "{\"name\":\"rotation\",\"ph\":\"C\",\"pid\":1,\"ts\":%.3f,\"args\":{\"yaw\":%.5f,\"pitch\":%.5f}},\n"
+      "{\"name\":\"fov\",\"ph\":\"C\",\"pid\":1,\"ts\":%.3f,\"args\":{\"fov\":%.3f}},\n"
+      "{\"name\":\"camera calls\",\"ph\":\"C\",\"pid\":1,\"ts\":%.3f,\"args\":{\"made\":%u,\"skipped\":%u}}",
+      name, end_us - duration_us, duration_us, frame.session, frame.progress, (frame.flags & kTraceHitch) ? "true" : "false",
+      end_us, frame.progress,
+      end_us, frame.frame_time * 1000.0,
+      end_us, p.pos[0], p.pos[1], p.pos[2],
+      end_us, p.rot[0], p.rot[1],
+      end_us, p.fov,
+      end_us, static_cast<unsigned>(frame.calls_made), static_cast<unsigned>(frame.calls_skipped));
+  return length > 0 && length < size ? length : 0;
+}
+
+std::string ReadFile(const char* path) {
+  std::string text;
+  if (FILE* file = std::fopen(path, "rb")) {
+    char buffer[4096];
+    size_t read;
+    while ((read = std::fread(buffer, 1, sizeof(buffer), file)) > 0)
+      text.append(buffer, read);
+    std::fclose(file);
+  }
+  return text;
+}
+
+}  // namespace
+
+int main() {
+  static TraceRing ring;
+  static TraceFrame batch[256];
+
+  // --- Frame thread cost ---
+  std::printf("Frame thread, per recorded frame\n");
+  TraceFrame frame = MakeFrame(7);
+  PrintResult("PushTraceFrame (ring drained every 256)", MeasureNsPerOp(20'000'000, [&](uint64_t i) {
+    frame.time = static_cast<double>(i);
+    PushTraceFrame(ring, frame);
+    if ((i & 255) == 255)
+      PopTraceFrames(ring, batch, 256);
+  }));
+
+  std::printf("  %-44s %10zu bytes\n", "record in the ring", sizeof(TraceFrame));
+  std::printf("  %-44s %10zu bytes\n", "ring size", sizeof(TraceRing));
+
+  // --- Writer thread cost ---
+  std::printf("Writer thread, per recorded frame\n");
+  char text[kTraceFrameTextSize];
+  int length = 0;
+  PrintResult("FormatTraceFrame", MeasureNsPerOp(1'000'000, [&](uint64_t i) {
+    frame.time = static_cast<double>(i);
+    length = FormatTraceFrame(frame, text, sizeof(text));
+    DoNotOptimize(text[0]);
+  }));
+  PrintResult("before: snprintf", MeasureNsPerOp(200'000, [&](uint64_t i) {
+    frame.time = static_cast<double>(i);
+    FormatTraceFrameWithSnprintf(frame, text, sizeof(text));
+    DoNotOptimize(text[0]);
+  }));
+  std::printf("  %-44s %10d bytes\n", "trace text", length);
+
+  // Same text as snprintf, over a spread of timestamps, poses and flags.
+  bool same_text = true;
+  for (uint64_t i = 0; i < 100'000 && same_text; ++i) {
+    TraceFrame sample = MakeFrame(i * 7919);
+    sample.time = static_cast<double>((i * 7919) % 6'000'000) / 60.0; // Up to a day and a bit
+    sample.frame_time = 1.0f / static_cast<float>(30 + (i % 200));
+    sample.pose.pos[0] = static_cast<float>(i % 2001) * 0.001f - 1.0f;
+    sample.pose.rot[1] = -static_cast<float>(i % 157) * 0.01f;
+    sample.pose.fov = 40.0f + static_cast<float>(i % 500) * 0.1f;
+    sample.calls_skipped = static_cast<uint8_t>(i);
+    sample.flags = static_cast<uint8_t>(i % 4 == 0 ? kTraceHitch : (i % 4 == 1 ? kTraceTowardsTarget : 0));
+    sample.kind = i % 5 == 0 ? kTraceHold : kTraceAnimation;
+    char expected[kTraceFrameTextSize];
+    int got = FormatTraceFrame(sample, text, sizeof(text));
+    int want = FormatTraceFrameWithSnprintf(sample, expected, sizeof(expected));
+    if (got != want || std::memcmp(text, expected, static_cast<size_t>(got)) != 0) {
+      std::printf("FAILED: frame %llu formats as\n%.*s\ninstead of\n%.*s\n", static_cast<unsigned long long>(i), got, text, want, expected);
+      same_text = false;
+    }
+  }
+
+  // --- Writer stress ---
+  const std::string path = std::string(P_tmpdir) + "/spf_fbv_trace_bench.json";
+  static TraceWriter writer;
+  if (!StartTraceWriter(writer, ring, path.c_str())) {
+    std::printf("FAILED: cannot create %s\n", path.c_str());
+    return 1;
+  }
+
+  constexpr uint64_t kFrames = 200'000;
+  uint64_t pushed = 0;
+  for (uint64_t i = 0; i < kFrames; ++i) {
+    PushTraceFrame(ring, MakeFrame(i));
+    ++pushed;
+    if ((i & 1023) == 1023)
+      std::this_thread::yield();
+  }
+  auto stop_start = std::chrono::steady_clock::now();
+  StopTraceWriter(writer);
+  double stop_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - stop_start).count();
+
+  uint64_t dropped = ring.dropped.load();
+  std::string file = ReadFile(path.c_str());
+  std::remove(path.c_str());
+
+  std::printf("Writer stress, %llu frames\n", static_cast<unsigned long long>(pushed));
+  std::printf("  %-44s %10llu\n", "written", static_cast<unsigned long long>(writer.frames_written));
+  std::printf("  %-44s %10llu\n", "dropped (ring full)", static_cast<unsigned long long>(dropped));
+  std::printf("  %-44s %10.1f MB\n", "file size", static_cast<double>(file.size()) / (1024.0 * 1024.0));
+  std::printf("  %-44s %10.2f ms\n", "StopTraceWriter (drains what is left)", stop_ms);
+
+  bool accounted = writer.frames_written + dropped == pushed;
+  bool closed = file.rfind("{\"displayTimeUnit\"", 0) == 0 && file.size() > 4 && file.compare(file.size() - 3, 3, "]}\n") == 0;
+  bool has_events = std::strstr(file.c_str(), "\"ph\":\"X\"") != nullptr;
+  // Stopping must not wait out the 50 ms drain interval. Here it also formats up to a full ring.
+  bool stopped_promptly = stop_ms < 40.0;
+  if (!stopped_promptly)
+    std::printf("FAILED: StopTraceWriter waited on the drain interval\n");
+  if (!accounted)
+    std::printf("FAILED: written + dropped != pushed\n");
+  if (!closed || !has_events)
+    std::printf("FAILED: the trace file is not a closed JSON document with events\n");
+  return same_text && stopped_promptly && accounted && closed && has_events ? 0 : 1;
+}
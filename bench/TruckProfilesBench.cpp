@@ -0,0 +1,95 @@
+/**
+ * @file TruckProfilesBench.cpp
+ * @brief Cost of picking the peek pose when the player switches trucks.
+ *
+ * @details Fills the profile table to its maximum load with realistic truck identities and
+ * measures the full switch (hash of `brand_id` + `id` plus the probe) for known and unknown
+ * trucks. A linear scan comparing the stored "brand_id/id" names is shown for reference, as is
+ * the hand-over of the identity from the telemetry thread. The executable returns 1 if any stored
+ * truck is not found again, an unknown one is, or the hand-over loses or repeats an identity.
+ */
+#include "BenchUtils.hpp"
+#include "TruckProfiles.hpp"
+
+#include <cstdio>  // For std::snprintf, std::printf
+#include <cstring> // For std::strcmp
+
+using namespace SPF_FrontalBlindspotViewer;
+using namespace SPF_FrontalBlindspotViewer::Bench;
+
+int main() {
+  const char* brands[] = { "scania", "volvo", "daf", "man", "mercedes", "renault", "iveco", "kenworth" };
+  constexpr int kTrucks = TruckProfileTable::kMaxCount;
+
+  char brand_ids[kTrucks][64];
+  char ids[kTrucks][64];
+  char names[kTrucks][128];
+  TruckProfileTable table;
+  bool ok = true;
+  for (int i = 0; i < kTrucks; ++i) {
+    std::snprintf(brand_ids[i], sizeof(brand_ids[i]), "%s", brands[i % 8]);
+    std::snprintf(ids[i], sizeof(ids[i]), "%s.model_%d", brands[i % 8], i);
+    std::snprintf(names[i], sizeof(names[i]), "%.63s/%.63s", brand_ids[i], ids[i]);
+    int slot = InsertTruckProfile(table, HashTruckIdentity(brand_ids[i], ids[i]));
+    ok = ok && slot >= 0;
+    if (slot >= 0) {
+      table.slots[slot].pose.fov = static_cast<float>(i);
+    }
+  }
+
+  for (int i = 0; i < kTrucks; ++i) {
+    int slot = FindTruckProfile(table, HashTruckIdentity(brand_ids[i], ids[i]));
+    ok = ok && slot >= 0 && table.slots[slot].pose.fov == static_cast<float>(i);
+  }
+  ok = ok && FindTruckProfile(table, HashTruckIdentity("scania", "unknown")) < 0;
+  ok = ok && InsertTruckProfile(table, HashTruckIdentity("scania", "one_too_many")) < 0;
+
+  std::printf("Truck switch with %d stored profiles\n", kTrucks);
+  double known = MeasureNsPerOp(2'000'000, [&](uint64_t i) {
+    int t = static_cast<int>(i % kTrucks);
+    DoNotOptimize(FindTruckProfile(table, HashTruckIdentity(brand_ids[t], ids[t])));
+  });
+  double unknown = MeasureNsPerOp(2'000'000, [&](uint64_t i) {
+    DoNotOptimize(FindTruckProfile(table, HashTruckIdentity("scania", (i & 1) ? "s_2016" : "r_2016")));
+  });
+  double scan = MeasureNsPerOp(2'000'000, [&](uint64_t i) {
+    const char* name = names[i % kTrucks];
+    int found = -1;
+    for (int n = 0; n < kTrucks && found < 0; ++n) {
+      if (std::strcmp(names[n], name) == 0) {
+        found = n;
+      }
+    }
+    DoNotOptimize(found);
+  });
+  PrintResult("hash + probe, known truck", known);
+  PrintResult("hash + probe, unknown truck", unknown);
+  PrintResult("reference: linear name scan", scan);
+
+  // Telemetry thread to frame loop: one publish, then a frame that applies it and one that does not.
+  TruckIdentityExchange exchange;
+  uint32_t seen = 0;
+  TruckIdentity identity;
+  ok = ok && !ReadTruckIdentity(exchange, seen, identity);
+  PublishTruckIdentity(exchange, brand_ids[5], ids[5]);
+  ok = ok && ReadTruckIdentity(exchange, seen, identity) && identity.key == HashTruckIdentity(brand_ids[5], ids[5]) &&
+       std::strcmp(identity.name, names[5]) == 0;
+  ok = ok && !ReadTruckIdentity(exchange, seen, identity);
+  PublishTruckIdentity(exchange, "", "");
+  ok = ok && ReadTruckIdentity(exchange, seen, identity) && identity.key == 0 && identity.name[0] == '\0';
+
+  double publish = MeasureNsPerOp(2'000'000, [&](uint64_t i) {
+    int t = static_cast<int>(i % kTrucks);
+    PublishTruckIdentity(exchange, brand_ids[t], ids[t]);
+  });
+  double idle = MeasureNsPerOp(2'000'000, [&](uint64_t) {
+    DoNotOptimize(ReadTruckIdentity(exchange, seen, identity));
+  });
+  PrintResult("publish identity (telemetry thread)", publish);
+  PrintResult("check for a new identity (per frame)", idle);
+
+  if (!ok) {
+    std::printf("FAILED: the profile table or the identity hand-over lost or invented a truck\n");
+  }
+  return ok ? 0 : 1;
+}